@@ -0,0 +1,177 @@
+/*  Copyright (c) 2013, Bo Li, prclibo@gmail.com
+    All rights reserved.
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in the
+          documentation and/or other materials provided with the distribution.
+        * Neither the name of the copyright holder nor the
+          names of its contributors may be used to endorse or promote products
+          derived from this software without specific prior written permission.
+    
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <opencv2/opencv.hpp>
+#include "one-point/one-point.hpp"
+#include "five-point-nister/five-point.hpp"
+#include "four-point-groebner/four-point-groebner.hpp"
+#include "cascade.hpp"
+
+/*
+ * The 1-point model is only used as a filter, as in D. Scaramuzza, 
+ * "1-point-ransac structure from motion for vehicle-mounted cameras by 
+ * exploiting non-holonomic constraints", IJCV 2011. The survivors have 
+ * a much lower outlier ratio, which the adaptive bound of the second 
+ * RANSAC measures itself, so it keeps the default cap of 2000. 
+ */
+
+using namespace cv; 
+
+// Indices of the points that survive the 1-point filter
+static std::vector<int> cascade_prefilter(const Mat & points1, const Mat & points2, 
+                                          double focal, Point2d pp, 
+                                          int prefilterMethod, double prefilterThreshold, double prob)
+{
+    Mat rvec, tvec, mask; 
+    findPose1pt(points1, points2, focal, pp, rvec, tvec, prefilterMethod, prob, prefilterThreshold, mask); 
+
+    std::vector<int> idx; 
+    const uchar * m = mask.ptr<uchar>(); 
+    for (int i = 0; i < (int)mask.total(); i++)
+        if (m[i]) idx.push_back(i); 
+    return idx; 
+}
+
+static void cascade_select(const Mat & points, const std::vector<int> & idx, Mat & selected)
+{
+    selected.create((int)idx.size(), 1, CV_64FC2); 
+    for (int i = 0; i < (int)idx.size(); i++)
+        selected.at<Vec2d>(i) = points.at<Vec2d>(idx[i]); 
+}
+
+// Sampson error of every point against E, in pixels squared as the 
+// threshold of the RANSAC functions. 
+static void cascade_mask(const Mat & points1, const Mat & points2, const Matx33d & E, 
+                         double focal, Point2d pp, double threshold, OutputArray _mask)
+{
+    int n = (int)points1.total(); 
+    _mask.create(1, n, CV_8U, -1, true); 
+    Mat mask = _mask.getMat(); 
+
+    double t = threshold / focal; 
+    for (int i = 0; i < n; i++)
+    {
+        Vec2d q1 = points1.at<Vec2d>(i), q2 = points2.at<Vec2d>(i); 
+        Vec3d x1((q1[0] - pp.x) / focal, (q1[1] - pp.y) / focal, 1.0); 
+        Vec3d x2((q2[0] - pp.x) / focal, (q2[1] - pp.y) / focal, 1.0); 
+        Vec3d Ex1 = E * x1; 
+        Vec3d Etx2 = E.t() * x2; 
+        double x2tEx1 = x2.dot(Ex1); 
+        double a = Ex1[0] * Ex1[0] + Ex1[1] * Ex1[1]; 
+        double b = Etx2[0] * Etx2[0] + Etx2[1] * Etx2[1]; 
+        mask.at<uchar>(i) = x2tEx1 * x2tEx1 / (a + b) <= t * t; 
+    }
+}
+
+static void cascade_points(InputArray _points, Mat & points)
+{
+    Mat p = _points.getMat(); 
+    int npoints = p.checkVector(2); 
+    CV_Assert( npoints >= 0 ); 
+    p.reshape(2, npoints).convertTo(points, CV_64F); 
+}
+
+Mat findEssentialMat_cascade(cv::InputArray _points1, cv::InputArray _points2, 
+              double focal, cv::Point2d pp, 
+              int prefilterMethod, double prefilterThreshold, 
+              int method, double prob, double threshold, cv::OutputArray _mask)
+{
+    Mat points1, points2; 
+    cascade_points(_points1, points1); 
+    cascade_points(_points2, points2); 
+    CV_Assert( points1.total() >= 5 && points1.total() == points2.total() ); 
+
+    std::vector<int> idx = cascade_prefilter(points1, points2, focal, pp, 
+                                             prefilterMethod, prefilterThreshold, prob); 
+
+    // Too few survivors for RANSAC, fall back to the full set
+    Mat E; 
+    if (idx.size() > 5)
+    {
+        Mat s1, s2; 
+        cascade_select(points1, idx, s1); 
+        cascade_select(points2, idx, s2); 
+        E = findEssentialMat(s1, s2, focal, pp, method, prob, threshold); 
+    }
+    else
+        E = findEssentialMat(points1, points2, focal, pp, method, prob, threshold); 
+
+    if (_mask.needed())
+    {
+        if (E.empty())
+        {
+            // no solution, e.g. the fallback on exactly 5 points
+            _mask.create(1, (int)points1.total(), CV_8U, -1, true); 
+            _mask.getMat().setTo(0); 
+        }
+        else
+            // the first solution if the fallback returned several
+            cascade_mask(points1, points2, Matx33d(E.ptr<double>()), focal, pp, threshold, _mask); 
+    }
+    return E; 
+}
+
+void findPose4pt_cascade(cv::InputArray _points1, cv::InputArray _points2, 
+              double angle, double focal, cv::Point2d pp, 
+              cv::OutputArray _rvecs, cv::OutputArray _tvecs, 
+              int prefilterMethod, double prefilterThreshold, 
+              int method, double prob, double threshold, cv::OutputArray _mask)
+{
+    Mat points1, points2; 
+    cascade_points(_points1, points1); 
+    cascade_points(_points2, points2); 
+    CV_Assert( points1.total() >= 4 && points1.total() == points2.total() ); 
+
+    std::vector<int> idx = cascade_prefilter(points1, points2, focal, pp, 
+                                             prefilterMethod, prefilterThreshold, prob); 
+
+    if (idx.size() > 4)
+    {
+        Mat s1, s2; 
+        cascade_select(points1, idx, s1); 
+        cascade_select(points2, idx, s2); 
+        findPose4pt_groebner(s1, s2, angle, focal, pp, _rvecs, _tvecs, method, prob, threshold); 
+    }
+    else
+        findPose4pt_groebner(points1, points2, angle, focal, pp, _rvecs, _tvecs, method, prob, threshold, noArray()); 
+
+    if (_mask.needed())
+    {
+        Mat rvecs = _rvecs.getMat(), tvecs = _tvecs.getMat(); 
+        if (rvecs.empty())
+        {
+            // no solution, e.g. the fallback on exactly 4 points
+            _mask.create(1, (int)points1.total(), CV_8U, -1, true); 
+            _mask.getMat().setTo(0); 
+            return; 
+        }
+        Matx33d R; 
+        Rodrigues(rvecs.col(0), R); 
+        Vec3d t(tvecs.at<double>(0, 0), tvecs.at<double>(1, 0), tvecs.at<double>(2, 0)); 
+        Matx33d tskew(0, -t[2], t[1], t[2], 0, -t[0], -t[1], t[0], 0); 
+        cascade_mask(points1, points2, tskew * R, focal, pp, threshold, _mask); 
+    }
+}
@@ -0,0 +1,50 @@
+/*  Copyright (c) 2013, Bo Li, prclibo@gmail.com
+    All rights reserved.
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in the
+          documentation and/or other materials provided with the distribution.
+        * Neither the name of the copyright holder nor the
+          names of its contributors may be used to endorse or promote products
+          derived from this software without specific prior written permission.
+    
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef CASCADE_HPP
+#define CASCADE_HPP
+
+#include <opencv2/opencv.hpp>
+
+/*
+ * Cascaded estimation for vehicle data: findPose1pt() with the loose 
+ * prefilterThreshold (and prefilterMethod, CV_RANSAC or ONE_POINT_VOTING) 
+ * throws away the gross outliers, then the 5-point or 4-point RANSAC 
+ * runs on the survivors only. The returned mask is computed on all 
+ * points with threshold. 
+ */
+cv::Mat findEssentialMat_cascade(cv::InputArray points1, cv::InputArray points2, 
+              double focal, cv::Point2d pp, 
+              int prefilterMethod, double prefilterThreshold, 
+              int method, double prob, double threshold, cv::OutputArray _mask); 
+
+void findPose4pt_cascade(cv::InputArray points1, cv::InputArray points2, 
+              double angle, double focal, cv::Point2d pp, 
+              cv::OutputArray rvecs, cv::OutputArray tvecs, 
+              int prefilterMethod, double prefilterThreshold, 
+              int method, double prob, double threshold, cv::OutputArray _mask); 
+
+#endif
@@ -38,8 +38,11 @@ class CvEMEstimator : public CvModelEstimator2
 {
 public:
     CvEMEstimator(); 
+    CvEMEstimator( int _modelPoints ); 
     virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model ); 
     virtual int run5Point( const CvMat* _q1, const CvMat* _q2, CvMat* _ematrix ); 
+    int solveNullspace( Mat & Q, CvMat* ematrix ); 
+    virtual bool fitWeighted( const CvMat* m1, const CvMat* m2, const CvMat* weights, CvMat* model ); 
 //protected: 
 	bool reliable( const CvMat* m1, const CvMat* m2, const CvMat* model ); 
     virtual void getCoeffMat( double *eet, double* a ); 
@@ -51,7 +54,7 @@ public:
 
 // Input should be a vector of n 2D points or a Nx2 matrix
 Mat findEssentialMat( InputArray _points1, InputArray _points2, double focal, Point2d pp, 
-					int method, double prob, double threshold, OutputArray _mask) 
+					int method, double prob, double threshold, OutputArray _mask, int maxIters) 
 {
 	Mat points1, points2; 
 	_points1.getMat().copyTo(points1); 
@@ -97,13 +100,15 @@ Mat findEssentialMat( InputArray _points1, InputArray _points2, double focal, Po
         E = E.rowRange(0, 3 * count) * 1.0; 
         Mat(tempMask).setTo(true); 
     }
-    else if (method == CV_RANSAC)
+    else if (method == CV_RANSAC || method == ESSENTIAL_MAGSAC)
 	{
-		estimator.runRANSAC(&p1, &p2, &_E, tempMask, threshold, prob); 
+		if (method == ESSENTIAL_MAGSAC)
+			estimator.setScoring(CvModelEstimator2::SCORE_MAGSAC); 
+		estimator.runRANSAC(&p1, &p2, &_E, tempMask, threshold, prob, maxIters); 
 	}
 	else
 	{
-		estimator.runLMeDS(&p1, &p2, &_E, tempMask, prob); 
+		estimator.runLMeDS(&p1, &p2, &_E, tempMask, prob, maxIters); 
 	}
     if (_mask.needed())
     {
@@ -117,6 +122,85 @@ Mat findEssentialMat( InputArray _points1, InputArray _points2, double focal, Po
 
 }
 
+EssentialMatTracker::EssentialMatTracker( double _focal, Point2d _pp, double _prob, double _threshold )
+	: estimator(new CvEMEstimator), focal(_focal), prob(_prob), threshold(_threshold), pp(_pp)
+{
+}
+
+EssentialMatTracker::~EssentialMatTracker()
+{
+	delete estimator; 
+}
+
+void EssentialMatTracker::reset()
+{
+	E.release(); 
+}
+
+Mat EssentialMatTracker::update( InputArray _points1, InputArray _points2, OutputArray _mask, 
+					InputArray _prediction )
+{
+	Mat points1, points2; 
+	_points1.getMat().copyTo(points1); 
+	_points2.getMat().copyTo(points2); 
+
+	int npoints = points1.checkVector(2);
+    CV_Assert( npoints >= 5 && points2.checkVector(2) == npoints &&
+				              points1.type() == points2.type());
+
+	if (points1.channels() > 1)
+	{
+		points1 = points1.reshape(1, npoints); 
+		points2 = points2.reshape(1, npoints); 
+	}
+	points1.convertTo(points1, CV_64F); 
+	points2.convertTo(points2, CV_64F); 
+
+	points1.col(0) = (points1.col(0) - pp.x) / focal; 
+	points2.col(0) = (points2.col(0) - pp.x) / focal; 
+	points1.col(1) = (points1.col(1) - pp.y) / focal; 
+	points2.col(1) = (points2.col(1) - pp.y) / focal; 
+
+	points1 = points1.reshape(2, 1); 
+	points2 = points2.reshape(2, 1); 
+
+	// The previous E and the prediction are scored before any sample
+	Mat initial; 
+	if (!E.empty())
+		initial.push_back(E); 
+	if (!_prediction.empty())
+	{
+		Mat prediction; 
+		_prediction.getMat().convertTo(prediction, CV_64F); 
+		CV_Assert(prediction.rows == 3 && prediction.cols == 3); 
+		initial.push_back(prediction); 
+	}
+	CvMat _initial = initial; 
+	estimator->setInitialModels(initial.empty() ? NULL : &_initial); 
+
+	Mat model(3, 3, CV_64F), tempMask(1, npoints, CV_8U); 
+	CvMat p1 = points1; 
+	CvMat p2 = points2; 
+	CvMat _model = model; 
+	CvMat _tempMask = tempMask; 
+	bool found = estimator->runRANSAC(&p1, &p2, &_model, &_tempMask, threshold / focal, prob); 
+	estimator->setInitialModels(NULL); 
+
+	if (found)
+		model.copyTo(E); 
+	else
+		tempMask.setTo(0); 
+
+    if (_mask.needed())
+    {
+    	_mask.create(1, npoints, CV_8U, -1, true); 
+    	Mat mask = _mask.getMat(); 
+    	tempMask.copyTo(mask); 
+    }
+
+	return found ? model : Mat(); 
+}
+
 int recoverPose( const Mat & E, InputArray _points1, InputArray _points2, Mat & _R, Mat & _t, 
 					double focal, Point2d pp, 
 					InputOutputArray _mask) 
@@ -271,6 +355,11 @@ CvEMEstimator::CvEMEstimator()
 {
 }
 
+CvEMEstimator::CvEMEstimator( int _modelPoints )
+: CvModelEstimator2( _modelPoints, cvSize(3,3),  10 )
+{
+}
+
 int CvEMEstimator::runKernel( const CvMat* m1, const CvMat* m2, CvMat* model )
 {
     return run5Point(m1, m2, model); 
@@ -295,6 +384,14 @@ int CvEMEstimator::run5Point( const CvMat* q1, const CvMat* q2, CvMat* ematrix )
 	Q.col(7) = Q1.col(1) * 1.0; 
 	Q.col(8) = 1.0; 
 
+    return solveNullspace(Q, ematrix); 
+}
+
+// Q holds one linear constraint on the row-major E per row, at least 5 
+// of them. E is searched in the span of the 4 smallest right singular 
+// vectors of Q, so extra rows are used in the least-squares sense. 
+int CvEMEstimator::solveNullspace( Mat & Q, CvMat* ematrix )
+{
     Mat U, W, Vt; 
     SVD::compute(Q, W, U, Vt, SVD::MODIFY_A | SVD::FULL_UV); 
     
@@ -383,6 +480,47 @@ int CvEMEstimator::run5Point( const CvMat* q1, const CvMat* q2, CvMat* ematrix )
 
 }
 
+// Weighted 8-point fit, projected onto the essential matrices. Only the 
+// first 2 channels of m1 and m2 are read, so the affine packing of 
+// CvEMAffineEstimator works too. 
+bool CvEMEstimator::fitWeighted( const CvMat* m1, const CvMat* m2, const CvMat* weights, CvMat* model )
+{
+    int n = m1->rows * m1->cols, cn = CV_MAT_CN(m1->type), used = 0; 
+    const double * p1 = m1->data.db; 
+    const double * p2 = m2->data.db; 
+    const float * w = weights->data.fl; 
+
+    Matx<double, 9, 9> A = Matx<double, 9, 9>::zeros(); 
+    for (int i = 0; i < n; i++)
+    {
+        if (w[i] <= 0) continue; 
+        const double * x1 = p1 + i * cn, * x2 = p2 + i * cn; 
+        double a[9] = {x2[0] * x1[0], x2[0] * x1[1], x2[0], 
+                       x2[1] * x1[0], x2[1] * x1[1], x2[1], 
+                       x1[0], x1[1], 1.0}; 
+        for (int r = 0; r < 9; r++)
+            for (int c = r; c < 9; c++)
+                A(r, c) += w[i] * a[r] * a[c]; 
+        used++; 
+    }
+    if (used < 8) 
+        return false; 
+    for (int r = 0; r < 9; r++)
+        for (int c = 0; c < r; c++)
+            A(r, c) = A(c, r); 
+
+    Matx<double, 9, 1> evals; 
+    Matx<double, 9, 9> evecs; 
+    eigen(A, evals, evecs); 
+
+    Mat E = Mat(evecs.row(8)).reshape(1, 3), sv, U, Vt; 
+    SVD::compute(E, sv, U, Vt); 
+    E = U * Mat::diag((Mat_<double>(3, 1) << 1, 1, 0)) * Vt; 
+    Mat dst(model); 
+    E.convertTo(dst, CV_64F, 1.0 / norm(E)); 
+    return true; 
+}
+
 // Same as the runKernel (run5Point), m1 and m2 should be
 // 1 row x n col x 2 channels. 
 // And also, error has to be of CV_32FC1. 
@@ -665,3 +803,203 @@ void CvEMEstimator::getCoeffMat(double *e, double *A)
     }
 }
 
+
+/*
+ * Essential matrix from 2 affine correspondences, following D. Barath and 
+ * L. Hajder, "Efficient recovery of essential matrix from two affine 
+ * correspondences", IEEE Transactions on Image Processing, 2018. 
+ *
+ * Besides x2' E x1 = 0, the local affine frame A of a correspondence gives 
+ * (E' x2)_(1:2) + A' (E x1)_(1:2) = 0, two more equations linear in E. 
+ * Two correspondences give 6 rows, which go through the same polynomial 
+ * as the 5-point solver. 
+ */
+class CvEMAffineEstimator : public CvEMEstimator
+{
+public:
+    CvEMAffineEstimator(); 
+    virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model ); 
+    virtual void computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error );
+protected: 
+    virtual bool checkSubset( const CvMat* ms1, int count ); 
+}; 
+
+CvEMAffineEstimator::CvEMAffineEstimator()
+: CvEMEstimator( 2 )
+{
+}
+
+// p1 = (x1, y1, a11, a12) and p2 = (x2, y2, a21, a22), writes the 3 
+// constraint rows on the row-major E. 
+static void affine_constraints( const double * p1, const double * p2, double * rows )
+{
+    double x1[3] = {p1[0], p1[1], 1.0}; 
+    double x2[3] = {p2[0], p2[1], 1.0}; 
+    double A[2][2] = {{p1[2], p1[3]}, {p2[2], p2[3]}}; 
+
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            rows[i * 3 + j] = x2[i] * x1[j]; 
+
+    for (int k = 0; k < 2; k++)
+    {
+        double * C = rows + 9 * (k + 1); 
+        for (int i = 0; i < 9; i++) C[i] = 0; 
+        for (int i = 0; i < 3; i++) C[i * 3 + k] += x2[i]; 
+        for (int m = 0; m < 2; m++)
+            for (int j = 0; j < 3; j++)
+                C[m * 3 + j] += A[m][k] * x1[j]; 
+    }
+}
+
+// m1 and m2 are 1 row x n col x 4 channels, the point followed by 
+// one row of the affine frame. 
+int CvEMAffineEstimator::runKernel( const CvMat* m1, const CvMat* m2, CvMat* model )
+{
+    int n = m1->rows * m1->cols; 
+    Mat Q(3 * n, 9, CV_64F); 
+    for (int i = 0; i < n; i++)
+        affine_constraints(m1->data.db + i * 4, m2->data.db + i * 4, Q.ptr<double>(3 * i)); 
+    Mat Q0 = Q.clone(); 
+    int count = solveNullspace(Q, model); 
+
+    // The 6 equations are only solved in the least-squares sense, and 
+    // with noise some roots of the polynomial fit them badly. Those are 
+    // dropped before they cost a scoring pass each; the best root is 
+    // kept even if none is below the tolerance. 
+    const double tol = 1e-2; 
+    for (int i = 0; i < Q0.rows; i++)
+        Q0.row(i) /= std::max(norm(Q0.row(i)), DBL_EPSILON); 
+
+    double * e = model->data.db; 
+    int kept = 0, best = -1; 
+    double bestResidual = DBL_MAX; 
+    std::vector<double> residuals(count); 
+    for (int k = 0; k < count; k++)
+    {
+        Mat r = Q0 * Mat(9, 1, CV_64F, e + 9 * k); 
+        residuals[k] = norm(r) / sqrt((double)Q0.rows); 
+        if (residuals[k] < bestResidual)
+        {
+            bestResidual = residuals[k]; 
+            best = k; 
+        }
+    }
+    for (int k = 0; k < count; k++)
+    {
+        if (residuals[k] > tol && k != best) 
+            continue; 
+        if (kept != k) 
+            memcpy(e + 9 * kept, e + 9 * k, 9 * sizeof(double)); 
+        kept++; 
+    }
+    return kept; 
+}
+
+// Sampson error of the point part only, error is CV_32FC1. 
+void CvEMAffineEstimator::computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error )
+{
+    Matx33d E(model->data.db); 
+    int n = m1->rows * m1->cols; 
+    for (int i = 0; i < n; i++)
+    {
+        const double * p1 = m1->data.db + i * 4; 
+        const double * p2 = m2->data.db + i * 4; 
+        Vec3d x1(p1[0], p1[1], 1.0), x2(p2[0], p2[1], 1.0); 
+        Vec3d Ex1 = E * x1; 
+        Vec3d Etx2 = E.t() * x2; 
+        double x2tEx1 = x2.dot(Ex1); 
+        double a = Ex1[0] * Ex1[0] + Ex1[1] * Ex1[1]; 
+        double b = Etx2[0] * Etx2[0] + Etx2[1] * Etx2[1]; 
+        error->data.fl[i] = (float)(x2tEx1 * x2tEx1 / (a + b)); 
+    }
+}
+
+// Two correspondences are never collinear, and the base class check 
+// expects 2-channel points. 
+bool CvEMAffineEstimator::checkSubset( const CvMat*, int )
+{
+    return true; 
+}
+
+// affines are the n local affine frames (a11, a12, a21, a22), mapping 
+// pixel offsets around points1 to offsets around points2. 
+Mat findEssentialMat2AC( InputArray _points1, InputArray _points2, InputArray _affines, 
+					double focal, Point2d pp, 
+					int method, double prob, double threshold, OutputArray _mask, int maxIters) 
+{
+	Mat points1, points2, affines; 
+	_points1.getMat().copyTo(points1); 
+	_points2.getMat().copyTo(points2); 
+	_affines.getMat().copyTo(affines); 
+
+	int npoints = points1.checkVector(2);
+    CV_Assert( npoints >= 2 && points2.checkVector(2) == npoints &&
+				              points1.type() == points2.type() && 
+                              affines.checkVector(4) == npoints );
+
+	if (points1.channels() > 1)
+	{
+		points1 = points1.reshape(1, npoints); 
+		points2 = points2.reshape(1, npoints); 
+	}
+    affines = affines.reshape(1, npoints); 
+	points1.convertTo(points1, CV_64F); 
+	points2.convertTo(points2, CV_64F); 
+    affines.convertTo(affines, CV_64F); 
+
+	points1.col(0) = (points1.col(0) - pp.x) / focal; 
+	points2.col(0) = (points2.col(0) - pp.x) / focal; 
+	points1.col(1) = (points1.col(1) - pp.y) / focal; 
+	points2.col(1) = (points2.col(1) - pp.y) / focal; 
+
+    // Both images are scaled by the same focal, so the affine frames 
+    // are unchanged. Pack the first row of each frame with points1 
+    // and the second with points2. 
+    Mat q1, q2; 
+    Mat cols1[] = {points1, affines.colRange(0, 2)}; 
+    Mat cols2[] = {points2, affines.colRange(2, 4)}; 
+    hconcat(cols1, 2, q1); 
+    hconcat(cols2, 2, q2); 
+    q1 = q1.reshape(4, 1); 
+    q2 = q2.reshape(4, 1); 
+
+	Mat E(3, 3, CV_64F); 
+	CvEMAffineEstimator estimator; 
+
+	CvMat p1 = q1; 
+	CvMat p2 = q2; 
+	CvMat _E = E;  
+	CvMat* tempMask = cvCreateMat(1, npoints, CV_8U); 
+	
+	threshold /= focal; 
+    if (npoints == 2)
+    {
+        E.create(3 * 10, 3, CV_64F); 
+        _E = E; 
+        int count = estimator.runKernel(&p1, &p2, &_E); 
+        E = E.rowRange(0, 3 * count) * 1.0; 
+        Mat(tempMask).setTo(true); 
+    }
+    else if (method == CV_RANSAC || method == ESSENTIAL_MAGSAC)
+	{
+		if (method == ESSENTIAL_MAGSAC)
+			estimator.setScoring(CvModelEstimator2::SCORE_MAGSAC); 
+		estimator.runRANSAC(&p1, &p2, &_E, tempMask, threshold, prob, maxIters); 
+	}
+	else
+	{
+		estimator.runLMeDS(&p1, &p2, &_E, tempMask, prob, maxIters); 
+	}
+    if (_mask.needed())
+    {
+    	_mask.create(1, npoints, CV_8U, -1, true); 
+    	Mat mask = _mask.getMat(); 
+    	Mat(tempMask).copyTo(mask); 
+    }
+    cvReleaseMat(&tempMask); 
+
+	return E; 
+}
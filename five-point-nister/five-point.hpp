@@ -32,9 +32,53 @@
 
 using namespace cv; 
 
+// method value for findEssentialMat and findEssentialMat2AC: RANSAC 
+// scored with MAGSAC++, where threshold is an upper bound on the error 
+// rather than a tuned inlier threshold. 
+enum { ESSENTIAL_MAGSAC = 38 }; 
+
+// maxIters caps the number of RANSAC samples (LMedS: hypotheses). 
 Mat findEssentialMat( InputArray points1, InputArray points2, double focal = 1.0, Point2d pp = Point2d(0, 0), 
 					int method = CV_RANSAC, 
-					double prob = 0.999, double threshold = 1, OutputArray mask = noArray() ); 
+					double prob = 0.999, double threshold = 1, OutputArray mask = noArray(), 
+					int maxIters = 2000 ); 
+
+// Essential matrix from affine correspondences, 2 per sample. affines 
+// is n x 4 (or a vector of Vec4d) holding the local affine frames 
+// (a11, a12, a21, a22) that map pixel offsets around points1 to pixel 
+// offsets around points2. method and maxIters are as in findEssentialMat. 
+Mat findEssentialMat2AC( InputArray points1, InputArray points2, InputArray affines, 
+					double focal = 1.0, Point2d pp = Point2d(0, 0), 
+					int method = CV_RANSAC, 
+					double prob = 0.999, double threshold = 1, OutputArray mask = noArray(), 
+					int maxIters = 2000 ); 
+
+// Essential matrix estimation over a video stream. The estimator and its
+// buffers are kept between frames, and RANSAC first scores the previous
+// frame's E and the optional prediction (a 3x3 essential matrix, e.g. from
+// an IMU), so a slowly moving camera usually terminates after a few samples.
+class CvEMEstimator; 
+class EssentialMatTracker
+{
+public: 
+	EssentialMatTracker( double focal = 1.0, Point2d pp = Point2d(0, 0), 
+					double prob = 0.999, double threshold = 1 ); 
+	~EssentialMatTracker(); 
+
+	Mat update( InputArray points1, InputArray points2, OutputArray mask = noArray(), 
+					InputArray prediction = noArray() ); 
+	// Forgets the previous E, e.g. after a cut in the stream
+	void reset(); 
+
+private: 
+	EssentialMatTracker( const EssentialMatTracker & ); 
+	EssentialMatTracker & operator=( const EssentialMatTracker & ); 
+
+	CvEMEstimator * estimator; 
+	double focal, prob, threshold; 
+	Point2d pp; 
+	Mat E; 
+}; 
 
 void decomposeEssentialMat( const Mat & E, Mat & R1, Mat & R2, Mat & t ); 
 
@@ -0,0 +1,234 @@
+/*  Copyright (c) 2013, Bo Li, prclibo@gmail.com
+    All rights reserved.
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in the
+          documentation and/or other materials provided with the distribution.
+        * Neither the name of the copyright holder nor the
+          names of its contributors may be used to endorse or promote products
+          derived from this software without specific prior written permission.
+    
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <cfloat>
+#include <iostream>
+#include <opencv2/opencv.hpp>
+#include <Eigen/Sparse>
+#include "four-point-groebner.hpp"
+#include "four-point-groebner-template.hpp"
+
+using namespace cv; 
+
+/*
+ * Times four_point_groebner() with each elimination backend on the same
+ * random minimal samples, and reports the error of the solution closest
+ * to the ground truth. Also times filling the elimination template from 
+ * the table in four-point-groebner-template.hpp, once with a triplet list 
+ * and setFromTriplets per sample as the old generated code did, and once 
+ * by writing the values into a fixed pattern as the solver does. 
+ * Usage: four-point-groebner-benchmark [nsamples]
+ */
+
+void four_point_groebner_coeffs(double p11, double p12, double p21, double p22, double p31, double p32, double p41, double p42,  
+                                double q11, double q12, double q21, double q22, double q31, double q32, double q41, double q42, 
+                                double k1, double k3, double c[113]); 
+
+struct Sample
+{
+    Mat x1s, x2s, rvec, tvec; 
+}; 
+
+static Sample makeSample(RNG & rng)
+{
+    double focal = 300; 
+    double bound_2d = 5; 
+
+    Sample s; 
+    s.rvec = Mat(3, 1, CV_64F); 
+    s.tvec = Mat(3, 1, CV_64F); 
+    rng.fill(s.rvec, RNG::UNIFORM, -0.5, 0.5); 
+    rng.fill(s.tvec, RNG::UNIFORM, -1, 1); 
+    normalize(s.tvec, s.tvec); 
+
+    Mat rmat; 
+    Rodrigues(s.rvec, rmat); 
+    Mat K = (Mat_<double>(3, 3) << focal, 0, 0, 0, focal, 0, 0, 0, 1); 
+
+    Mat Xs(4, 3, CV_64F); 
+    rng.fill(Xs, RNG::UNIFORM, -bound_2d, bound_2d); 
+    Xs.col(2) += 2 * bound_2d; 
+
+    Mat x1s = K * Xs.t(); 
+    Mat x2s = rmat * Xs.t(); 
+    for (int j = 0; j < x2s.cols; j++) x2s.col(j) += s.tvec; 
+    x2s = K * x2s; 
+
+    for (int i = 0; i < 2; i++)
+    {
+        x1s.row(i) /= x1s.row(2); 
+        x2s.row(i) /= x2s.row(2); 
+    }
+    s.x1s = x1s.rowRange(0, 2).t(); 
+    s.x2s = x2s.rowRange(0, 2).t(); 
+    return s; 
+}
+
+static double bestError(const Sample & s, const Mat & rvecs, const Mat & tvecs)
+{
+    double best = DBL_MAX; 
+    for (int i = 0; i < rvecs.cols; i++)
+    {
+        double err = norm(rvecs.col(i) - s.rvec) + norm(tvecs.col(i) - s.tvec); 
+        best = std::min(best, err); 
+    }
+    return best; 
+}
+
+// Normalized coordinates of the sample, as four_point_groebner() passes them
+static void sampleParams(const Sample & s, double p[18])
+{
+    for (int i = 0; i < 4; i++)
+    {
+        p[2 * i] = s.x1s.at<double>(i, 0) / 300; 
+        p[2 * i + 1] = s.x1s.at<double>(i, 1) / 300; 
+        p[8 + 2 * i] = s.x2s.at<double>(i, 0) / 300; 
+        p[8 + 2 * i + 1] = s.x2s.at<double>(i, 1) / 300; 
+    }
+    double angle = norm(s.rvec); 
+    p[16] = cos(angle); 
+    p[17] = sin(angle); 
+}
+
+static void timeTemplateFill(const std::vector<Sample> & samples)
+{
+    int N = (int)samples.size(); 
+    std::vector<double> params(18 * N); 
+    for (int i = 0; i < N; i++)
+        sampleParams(samples[i], &params[18 * i]); 
+
+    // Same scheme as the solver: build the pattern once with the
+    // coefficient indices as values, then only write the values.
+    int nentries = sizeof(four_point_groebner_template) / sizeof(four_point_groebner_template[0]); 
+    std::vector<Eigen::Triplet< double > > triplets; 
+    for (int i = 0; i < nentries; i++)
+        triplets.push_back(Eigen::Triplet< double >(four_point_groebner_template[i][0],
+                                                    four_point_groebner_template[i][1],
+                                                    four_point_groebner_template[i][2])); 
+    Eigen::SparseMatrix< double > table(four_point_groebner_template_rows, four_point_groebner_template_cols); 
+    table.setFromTriplets(triplets.begin(), triplets.end()); 
+    std::vector<int> slots(table.nonZeros()); 
+    for (int i = 0; i < table.nonZeros(); i++)
+        slots[i] = (int)table.valuePtr()[i]; 
+
+    Eigen::SparseMatrix< double > pushed; 
+    double diff = 0, checksum = 0; 
+    int64 t0 = getTickCount(); 
+    for (int i = 0; i < N; i++)
+    {
+        const double * p = &params[18 * i]; 
+        double c[113]; 
+        four_point_groebner_coeffs(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], 
+                                   p[8], p[9], p[10], p[11], p[12], p[13], p[14], p[15], p[16], p[17], c); 
+        std::vector<Eigen::Triplet< double > > entries; 
+        entries.reserve(nentries); 
+        for (int k = 0; k < nentries; k++)
+            entries.push_back(Eigen::Triplet< double >(four_point_groebner_template[k][0],
+                                                       four_point_groebner_template[k][1],
+                                                       c[four_point_groebner_template[k][2]])); 
+        pushed.resize(four_point_groebner_template_rows, four_point_groebner_template_cols); 
+        pushed.setFromTriplets(entries.begin(), entries.end()); 
+        checksum += pushed.valuePtr()[0]; 
+    }
+    int64 t1 = getTickCount(); 
+    for (int i = 0; i < N; i++)
+    {
+        const double * p = &params[18 * i]; 
+        double c[113]; 
+        four_point_groebner_coeffs(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], 
+                                   p[8], p[9], p[10], p[11], p[12], p[13], p[14], p[15], p[16], p[17], c); 
+        double * values = table.valuePtr(); 
+        for (size_t k = 0; k < slots.size(); k++)
+            values[k] = c[slots[k]]; 
+        checksum += values[0]; 
+    }
+    int64 t2 = getTickCount(); 
+
+    // Both fills have to give the same matrix on the last sample
+    if (N > 0)
+        diff = (Eigen::MatrixXd(pushed) - Eigen::MatrixXd(table)).cwiseAbs().maxCoeff(); 
+
+    double scale = 1e6 / getTickFrequency() / std::max(N, 1); 
+    std::cout << "Template fill, push_back: " << (t1 - t0) * scale << " us/sample, table: "
+              << (t2 - t1) * scale << " us/sample, max difference " << diff
+              << " (checksum " << checksum << ")" << std::endl; 
+}
+
+int main(int argc, char ** argv)
+{
+    int N = argc > 1 ? atoi(argv[1]) : 500; 
+
+    RNG rng; 
+    std::vector<Sample> samples; 
+    for (int i = 0; i < N; i++)
+        samples.push_back(makeSample(rng)); 
+
+    timeTemplateFill(samples); 
+
+    const char * names[] = {"SparseQR", "SPQR", "Dense LU"}; 
+    int backends[] = {GROEBNER_SPARSE_QR, GROEBNER_SPQR, GROEBNER_DENSE_LU}; 
+
+    for (int b = 0; b < 3; b++)
+    {
+#ifndef FOUR_POINT_GROEBNER_USE_SPQR
+        if (backends[b] == GROEBNER_SPQR)
+        {
+            std::cout << names[b] << ": not built, set FOUR_POINT_GROEBNER_USE_SPQR=ON" << std::endl; 
+            continue; 
+        }
+#endif
+        int nsamples, nfallbacks; 
+        four_point_groebner_stats(nsamples, nfallbacks, true); 
+
+        std::vector<double> errs; 
+        int64 t0 = getTickCount(); 
+        for (int i = 0; i < N; i++)
+        {
+            Mat rvecs, tvecs; 
+            four_point_groebner(samples[i].x1s, samples[i].x2s, norm(samples[i].rvec), 300, Point2d(0, 0),
+                                rvecs, tvecs, backends[b]); 
+            if (!rvecs.empty())
+                errs.push_back(bestError(samples[i], rvecs, tvecs)); 
+        }
+        double ms = (getTickCount() - t0) * 1000.0 / getTickFrequency() / std::max(N, 1); 
+
+        four_point_groebner_stats(nsamples, nfallbacks, true); 
+        std::cout << names[b] << ": " << ms << " ms/sample, "; 
+        if (errs.empty())
+            std::cout << "no solutions"; 
+        else
+        {
+            std::sort(errs.begin(), errs.end()); 
+            int n = (int)errs.size(); 
+            std::cout << "median error " << errs[n / 2] << ", 99% error " << errs[n * 99 / 100]
+                      << ", solved " << n << "/" << N; 
+        }
+        std::cout << ", long double fallbacks " << nfallbacks << "/" << nsamples << std::endl; 
+    }
+
+    return 0; 
+}
@@ -0,0 +1,741 @@
+/*  Copyright (c) 2013, Bo Li, prclibo@gmail.com
+    All rights reserved.
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in the
+          documentation and/or other materials provided with the distribution.
+        * Neither the name of the copyright holder nor the
+          names of its contributors may be used to endorse or promote products
+          derived from this software without specific prior written permission.
+    
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef FOUR_POINT_GROEBNER_TEMPLATE_HPP
+#define FOUR_POINT_GROEBNER_TEMPLATE_HPP
+
+/*
+ * Non-zero entries of the 270x290 elimination template, 
+ * as {row, column, coefficient index}, sorted by column and row. 
+ * The value of an entry is c[coefficient index] of 
+ * four_point_groebner_coeffs().
+ *
+ * Removing a single row, or a single eliminated column together with 
+ * its rows, was tried on random samples, and each such removal made the 
+ * elimination rank deficient or changed the action matrix. Removing 
+ * several at once, or a different basis, was not tried. A smaller 
+ * template would have to be regenerated from the polynomial system. 
+ */
+static const int four_point_groebner_template_rows = 270; 
+static const int four_point_groebner_template_cols = 290; 
+static const unsigned short four_point_groebner_template[][3] = {
+    {227, 0, 1}, {244, 0, 28}, {258, 0, 55}, {226, 1, 1}, {227, 1, 2}, {244, 1, 29}, {258, 1, 56}, {225, 2, 1},
+    {226, 2, 2}, {224, 3, 1}, {225, 3, 2}, {243, 3, 28}, {224, 4, 2}, {243, 4, 29}, {227, 5, 3}, {244, 5, 30},
+    {258, 5, 57}, {223, 6, 1}, {226, 6, 3}, {227, 6, 4}, {242, 6, 28}, {244, 6, 31}, {258, 6, 58}, {222, 7, 1},
+    {223, 7, 2}, {225, 7, 3}, {226, 7, 4}, {242, 7, 29}, {221, 8, 1}, {222, 8, 2}, {224, 8, 3}, {225, 8, 4},
+    {241, 8, 28}, {243, 8, 30}, {221, 9, 2}, {224, 9, 4}, {241, 9, 29}, {243, 9, 31}, {223, 10, 3}, {227, 10, 5},
+    {242, 10, 30}, {244, 10, 32}, {258, 10, 59}, {220, 11, 1}, {222, 11, 3}, {223, 11, 4}, {226, 11, 5}, {240, 11, 28},
+    {242, 11, 31}, {257, 11, 55}, {219, 12, 1}, {220, 12, 2}, {221, 12, 3}, {222, 12, 4}, {225, 12, 5}, {239, 12, 28},
+    {240, 12, 29}, {241, 12, 30}, {256, 12, 55}, {257, 12, 56}, {219, 13, 2}, {221, 13, 4}, {224, 13, 5}, {239, 13, 29},
+    {241, 13, 31}, {243, 13, 32}, {256, 13, 56}, {220, 14, 3}, {223, 14, 5}, {240, 14, 30}, {242, 14, 32}, {257, 14, 57},
+    {218, 15, 1}, {219, 15, 3}, {220, 15, 4}, {222, 15, 5}, {238, 15, 28}, {239, 15, 30}, {240, 15, 31}, {255, 15, 55},
+    {256, 15, 57}, {257, 15, 58}, {218, 16, 2}, {219, 16, 4}, {221, 16, 5}, {238, 16, 29}, {239, 16, 31}, {241, 16, 32},
+    {255, 16, 56}, {256, 16, 58}, {218, 17, 3}, {220, 17, 5}, {238, 17, 30}, {240, 17, 32}, {255, 17, 57}, {257, 17, 59},
+    {218, 18, 4}, {219, 18, 5}, {238, 18, 31}, {239, 18, 32}, {255, 18, 58}, {256, 18, 59}, {218, 19, 5}, {238, 19, 32},
+    {255, 19, 59}, {217, 20, 1}, {226, 20, 6}, {227, 20, 7}, {237, 20, 28}, {244, 20, 34}, {254, 20, 55}, {258, 20, 61},
+    {268, 20, 82}, {216, 21, 1}, {217, 21, 2}, {225, 21, 6}, {226, 21, 7}, {236, 21, 28}, {237, 21, 29}, {253, 21, 55},
+    {254, 21, 56}, {267, 21, 82}, {268, 21, 83}, {215, 22, 1}, {216, 22, 2}, {224, 22, 6}, {225, 22, 7}, {235, 22, 28},
+    {236, 22, 29}, {243, 22, 33}, {252, 22, 55}, {253, 22, 56}, {266, 22, 82}, {267, 22, 83}, {214, 23, 1}, {215, 23, 2},
+    {224, 23, 7}, {234, 23, 28}, {235, 23, 29}, {243, 23, 34}, {251, 23, 55}, {252, 23, 56}, {265, 23, 82}, {266, 23, 83},
+    {214, 24, 2}, {234, 24, 29}, {251, 24, 56}, {265, 24, 83}, {217, 25, 3}, {223, 25, 6}, {227, 25, 8}, {237, 25, 30},
+    {242, 25, 33}, {244, 25, 35}, {254, 25, 57}, {258, 25, 62}, {268, 25, 84}, {213, 26, 1}, {216, 26, 3}, {217, 26, 4},
+    {222, 26, 6}, {223, 26, 7}, {226, 26, 8}, {227, 26, 9}, {233, 26, 28}, {236, 26, 30}, {237, 26, 31}, {242, 26, 34},
+    {244, 26, 36}, {250, 26, 55}, {253, 26, 57}, {254, 26, 58}, {258, 26, 63}, {264, 26, 82}, {267, 26, 84}, {268, 26, 85},
+    {212, 27, 1}, {213, 27, 2}, {215, 27, 3}, {216, 27, 4}, {221, 27, 6}, {222, 27, 7}, {225, 27, 8}, {226, 27, 9},
+    {232, 27, 28}, {233, 27, 29}, {235, 27, 30}, {236, 27, 31}, {241, 27, 33}, {249, 27, 55}, {250, 27, 56}, {252, 27, 57},
+    {253, 27, 58}, {263, 27, 82}, {264, 27, 83}, {266, 27, 84}, {267, 27, 85}, {211, 28, 1}, {212, 28, 2}, {214, 28, 3},
+    {215, 28, 4}, {221, 28, 7}, {224, 28, 8}, {225, 28, 9}, {231, 28, 28}, {232, 28, 29}, {234, 28, 30}, {235, 28, 31},
+    {241, 28, 34}, {243, 28, 35}, {248, 28, 55}, {249, 28, 56}, {251, 28, 57}, {252, 28, 58}, {262, 28, 82}, {263, 28, 83},
+    {265, 28, 84}, {266, 28, 85}, {211, 29, 2}, {214, 29, 4}, {224, 29, 9}, {231, 29, 29}, {234, 29, 31}, {243, 29, 36},
+    {248, 29, 56}, {251, 29, 58}, {262, 29, 83}, {265, 29, 85}, {213, 30, 3}, {217, 30, 5}, {220, 30, 6}, {223, 30, 8},
+    {227, 30, 10}, {233, 30, 30}, {237, 30, 32}, {240, 30, 33}, {242, 30, 35}, {244, 30, 37}, {250, 30, 57}, {254, 30, 59},
+    {257, 30, 60}, {258, 30, 64}, {264, 30, 84}, {268, 30, 86}, {210, 31, 1}, {212, 31, 3}, {213, 31, 4}, {216, 31, 5},
+    {219, 31, 6}, {220, 31, 7}, {222, 31, 8}, {223, 31, 9}, {226, 31, 10}, {230, 31, 28}, {232, 31, 30}, {233, 31, 31},
+    {236, 31, 32}, {239, 31, 33}, {240, 31, 34}, {242, 31, 36}, {247, 31, 55}, {249, 31, 57}, {250, 31, 58}, {253, 31, 59},
+    {256, 31, 60}, {257, 31, 61}, {261, 31, 82}, {263, 31, 84}, {264, 31, 85}, {267, 31, 86}, {209, 32, 1}, {210, 32, 2},
+    {211, 32, 3}, {212, 32, 4}, {215, 32, 5}, {219, 32, 7}, {221, 32, 8}, {222, 32, 9}, {225, 32, 10}, {229, 32, 28},
+    {230, 32, 29}, {231, 32, 30}, {232, 32, 31}, {235, 32, 32}, {239, 32, 34}, {241, 32, 35}, {246, 32, 55}, {247, 32, 56},
+    {248, 32, 57}, {249, 32, 58}, {252, 32, 59}, {256, 32, 61}, {260, 32, 82}, {261, 32, 83}, {262, 32, 84}, {263, 32, 85},
+    {266, 32, 86}, {209, 33, 2}, {211, 33, 4}, {214, 33, 5}, {221, 33, 9}, {224, 33, 10}, {229, 33, 29}, {231, 33, 31},
+    {234, 33, 32}, {241, 33, 36}, {243, 33, 37}, {246, 33, 56}, {248, 33, 58}, {251, 33, 59}, {260, 33, 83}, {262, 33, 85},
+    {265, 33, 86}, {210, 34, 3}, {213, 34, 5}, {218, 34, 6}, {220, 34, 8}, {223, 34, 10}, {230, 34, 30}, {233, 34, 32},
+    {238, 34, 33}, {240, 34, 35}, {242, 34, 37}, {247, 34, 57}, {250, 34, 59}, {255, 34, 60}, {257, 34, 62}, {261, 34, 84},
+    {264, 34, 86}, {208, 35, 1}, {209, 35, 3}, {210, 35, 4}, {212, 35, 5}, {218, 35, 7}, {219, 35, 8}, {220, 35, 9},
+    {222, 35, 10}, {228, 35, 28}, {229, 35, 30}, {230, 35, 31}, {232, 35, 32}, {238, 35, 34}, {239, 35, 35}, {240, 35, 36},
+    {245, 35, 55}, {246, 35, 57}, {247, 35, 58}, {249, 35, 59}, {255, 35, 61}, {256, 35, 62}, {257, 35, 63}, {259, 35, 82},
+    {260, 35, 84}, {261, 35, 85}, {263, 35, 86}, {208, 36, 2}, {209, 36, 4}, {211, 36, 5}, {219, 36, 9}, {221, 36, 10},
+    {228, 36, 29}, {229, 36, 31}, {231, 36, 32}, {239, 36, 36}, {241, 36, 37}, {245, 36, 56}, {246, 36, 58}, {248, 36, 59},
+    {256, 36, 63}, {259, 36, 83}, {260, 36, 85}, {262, 36, 86}, {208, 37, 3}, {210, 37, 5}, {218, 37, 8}, {220, 37, 10},
+    {228, 37, 30}, {230, 37, 32}, {238, 37, 35}, {240, 37, 37}, {245, 37, 57}, {247, 37, 59}, {255, 37, 62}, {257, 37, 64},
+    {259, 37, 84}, {261, 37, 86}, {208, 38, 4}, {209, 38, 5}, {218, 38, 9}, {219, 38, 10}, {228, 38, 31}, {229, 38, 32},
+    {238, 38, 36}, {239, 38, 37}, {245, 38, 58}, {246, 38, 59}, {255, 38, 63}, {256, 38, 64}, {259, 38, 85}, {260, 38, 86},
+    {208, 39, 5}, {218, 39, 10}, {228, 39, 32}, {238, 39, 37}, {245, 39, 59}, {255, 39, 64}, {259, 39, 86}, {213, 40, 6},
+    {217, 40, 8}, {233, 40, 33}, {237, 40, 35}, {250, 40, 60}, {254, 40, 62}, {264, 40, 87}, {268, 40, 89}, {212, 41, 6},
+    {213, 41, 7}, {216, 41, 8}, {217, 41, 9}, {232, 41, 33}, {233, 41, 34}, {236, 41, 35}, {237, 41, 36}, {249, 41, 60},
+    {250, 41, 61}, {253, 41, 62}, {254, 41, 63}, {263, 41, 87}, {264, 41, 88}, {267, 41, 89}, {268, 41, 90}, {211, 42, 6},
+    {212, 42, 7}, {215, 42, 8}, {216, 42, 9}, {231, 42, 33}, {232, 42, 34}, {235, 42, 35}, {236, 42, 36}, {248, 42, 60},
+    {249, 42, 61}, {252, 42, 62}, {253, 42, 63}, {262, 42, 87}, {263, 42, 88}, {266, 42, 89}, {267, 42, 90}, {211, 43, 7},
+    {214, 43, 8}, {215, 43, 9}, {231, 43, 34}, {234, 43, 35}, {235, 43, 36}, {248, 43, 61}, {251, 43, 62}, {252, 43, 63},
+    {262, 43, 88}, {265, 43, 89}, {266, 43, 90}, {214, 44, 9}, {234, 44, 36}, {251, 44, 63}, {265, 44, 90}, {210, 45, 6},
+    {213, 45, 8}, {217, 45, 10}, {230, 45, 33}, {233, 45, 35}, {237, 45, 37}, {247, 45, 60}, {250, 45, 62}, {254, 45, 64},
+    {261, 45, 87}, {264, 45, 89}, {268, 45, 91}, {209, 46, 6}, {210, 46, 7}, {212, 46, 8}, {213, 46, 9}, {216, 46, 10},
+    {229, 46, 33}, {230, 46, 34}, {232, 46, 35}, {233, 46, 36}, {236, 46, 37}, {246, 46, 60}, {247, 46, 61}, {249, 46, 62},
+    {250, 46, 63}, {253, 46, 64}, {260, 46, 87}, {261, 46, 88}, {263, 46, 89}, {264, 46, 90}, {267, 46, 91}, {209, 47, 7},
+    {211, 47, 8}, {212, 47, 9}, {215, 47, 10}, {229, 47, 34}, {231, 47, 35}, {232, 47, 36}, {235, 47, 37}, {246, 47, 61},
+    {248, 47, 62}, {249, 47, 63}, {252, 47, 64}, {260, 47, 88}, {262, 47, 89}, {263, 47, 90}, {266, 47, 91}, {211, 48, 9},
+    {214, 48, 10}, {231, 48, 36}, {234, 48, 37}, {248, 48, 63}, {251, 48, 64}, {262, 48, 90}, {265, 48, 91}, {208, 49, 6},
+    {210, 49, 8}, {213, 49, 10}, {228, 49, 33}, {230, 49, 35}, {233, 49, 37}, {245, 49, 60}, {247, 49, 62}, {250, 49, 64},
+    {259, 49, 87}, {261, 49, 89}, {264, 49, 91}, {269, 49, 109}, {208, 50, 7}, {209, 50, 8}, {210, 50, 9}, {212, 50, 10},
+    {228, 50, 34}, {229, 50, 35}, {230, 50, 36}, {232, 50, 37}, {245, 50, 61}, {246, 50, 62}, {247, 50, 63}, {249, 50, 64},
+    {259, 50, 88}, {260, 50, 89}, {261, 50, 90}, {263, 50, 91}, {209, 51, 9}, {211, 51, 10}, {229, 51, 36}, {231, 51, 37},
+    {246, 51, 63}, {248, 51, 64}, {260, 51, 90}, {262, 51, 91}, {269, 51, 110}, {208, 52, 8}, {210, 52, 10}, {228, 52, 35},
+    {230, 52, 37}, {245, 52, 62}, {247, 52, 64}, {259, 52, 89}, {261, 52, 91}, {208, 53, 9}, {209, 53, 10}, {228, 53, 36},
+    {229, 53, 37}, {245, 53, 63}, {246, 53, 64}, {259, 53, 90}, {260, 53, 91}, {208, 54, 10}, {228, 54, 37}, {245, 54, 64},
+    {259, 54, 91}, {269, 54, 111}, {134, 55, 1}, {155, 55, 28}, {175, 55, 55}, {194, 55, 82}, {226, 55, 11}, {227, 55, 12},
+    {244, 55, 39}, {258, 55, 66}, {133, 56, 1}, {134, 56, 2}, {154, 56, 28}, {155, 56, 29}, {174, 56, 55}, {175, 56, 56},
+    {193, 56, 82}, {194, 56, 83}, {225, 56, 11}, {226, 56, 12}, {227, 56, 13}, {244, 56, 40}, {258, 56, 67}, {132, 57, 1},
+    {133, 57, 2}, {153, 57, 28}, {154, 57, 29}, {173, 57, 55}, {174, 57, 56}, {192, 57, 82}, {193, 57, 83}, {224, 57, 11},
+    {225, 57, 12}, {226, 57, 13}, {243, 57, 38}, {131, 58, 1}, {132, 58, 2}, {152, 58, 28}, {153, 58, 29}, {172, 58, 55},
+    {173, 58, 56}, {191, 58, 82}, {192, 58, 83}, {224, 58, 12}, {225, 58, 13}, {243, 58, 39}, {131, 59, 2}, {152, 59, 29},
+    {172, 59, 56}, {191, 59, 83}, {224, 59, 13}, {243, 59, 40}, {134, 60, 3}, {155, 60, 30}, {175, 60, 57}, {194, 60, 84},
+    {223, 60, 11}, {227, 60, 14}, {242, 60, 38}, {244, 60, 41}, {258, 60, 68}, {130, 61, 1}, {133, 61, 3}, {134, 61, 4},
+    {151, 61, 28}, {154, 61, 30}, {155, 61, 31}, {171, 61, 55}, {174, 61, 57}, {175, 61, 58}, {190, 61, 82}, {193, 61, 84},
+    {194, 61, 85}, {222, 61, 11}, {223, 61, 12}, {226, 61, 14}, {227, 61, 15}, {242, 61, 39}, {244, 61, 42}, {258, 61, 69},
+    {129, 62, 1}, {130, 62, 2}, {132, 62, 3}, {133, 62, 4}, {150, 62, 28}, {151, 62, 29}, {153, 62, 30}, {154, 62, 31},
+    {170, 62, 55}, {171, 62, 56}, {173, 62, 57}, {174, 62, 58}, {189, 62, 82}, {190, 62, 83}, {192, 62, 84}, {193, 62, 85},
+    {221, 62, 11}, {222, 62, 12}, {223, 62, 13}, {225, 62, 14}, {226, 62, 15}, {241, 62, 38}, {242, 62, 40}, {128, 63, 1},
+    {129, 63, 2}, {131, 63, 3}, {132, 63, 4}, {149, 63, 28}, {150, 63, 29}, {152, 63, 30}, {153, 63, 31}, {169, 63, 55},
+    {170, 63, 56}, {172, 63, 57}, {173, 63, 58}, {188, 63, 82}, {189, 63, 83}, {191, 63, 84}, {192, 63, 85}, {221, 63, 12},
+    {222, 63, 13}, {224, 63, 14}, {225, 63, 15}, {241, 63, 39}, {243, 63, 41}, {128, 64, 2}, {131, 64, 4}, {149, 64, 29},
+    {152, 64, 31}, {169, 64, 56}, {172, 64, 58}, {188, 64, 83}, {191, 64, 85}, {221, 64, 13}, {224, 64, 15}, {241, 64, 40},
+    {243, 64, 42}, {130, 65, 3}, {134, 65, 5}, {151, 65, 30}, {155, 65, 32}, {171, 65, 57}, {175, 65, 59}, {190, 65, 84},
+    {194, 65, 86}, {220, 65, 11}, {223, 65, 14}, {240, 65, 38}, {242, 65, 41}, {257, 65, 65}, {127, 66, 1}, {129, 66, 3},
+    {130, 66, 4}, {133, 66, 5}, {148, 66, 28}, {150, 66, 30}, {151, 66, 31}, {154, 66, 32}, {168, 66, 55}, {170, 66, 57},
+    {171, 66, 58}, {174, 66, 59}, {187, 66, 82}, {189, 66, 84}, {190, 66, 85}, {193, 66, 86}, {219, 66, 11}, {220, 66, 12},
+    {222, 66, 14}, {223, 66, 15}, {239, 66, 38}, {240, 66, 39}, {242, 66, 42}, {256, 66, 65}, {257, 66, 66}, {126, 67, 1},
+    {127, 67, 2}, {128, 67, 3}, {129, 67, 4}, {132, 67, 5}, {147, 67, 28}, {148, 67, 29}, {149, 67, 30}, {150, 67, 31},
+    {153, 67, 32}, {167, 67, 55}, {168, 67, 56}, {169, 67, 57}, {170, 67, 58}, {173, 67, 59}, {186, 67, 82}, {187, 67, 83},
+    {188, 67, 84}, {189, 67, 85}, {192, 67, 86}, {219, 67, 12}, {220, 67, 13}, {221, 67, 14}, {222, 67, 15}, {239, 67, 39},
+    {240, 67, 40}, {241, 67, 41}, {256, 67, 66}, {257, 67, 67}, {126, 68, 2}, {128, 68, 4}, {131, 68, 5}, {147, 68, 29},
+    {149, 68, 31}, {152, 68, 32}, {167, 68, 56}, {169, 68, 58}, {172, 68, 59}, {186, 68, 83}, {188, 68, 85}, {191, 68, 86},
+    {219, 68, 13}, {221, 68, 15}, {239, 68, 40}, {241, 68, 42}, {256, 68, 67}, {127, 69, 3}, {130, 69, 5}, {148, 69, 30},
+    {151, 69, 32}, {168, 69, 57}, {171, 69, 59}, {187, 69, 84}, {190, 69, 86}, {218, 69, 11}, {220, 69, 14}, {238, 69, 38},
+    {240, 69, 41}, {255, 69, 65}, {257, 69, 68}, {125, 70, 1}, {126, 70, 3}, {127, 70, 4}, {129, 70, 5}, {146, 70, 28},
+    {147, 70, 30}, {148, 70, 31}, {150, 70, 32}, {166, 70, 55}, {167, 70, 57}, {168, 70, 58}, {170, 70, 59}, {185, 70, 82},
+    {186, 70, 84}, {187, 70, 85}, {189, 70, 86}, {218, 70, 12}, {219, 70, 14}, {220, 70, 15}, {238, 70, 39}, {239, 70, 41},
+    {240, 70, 42}, {255, 70, 66}, {256, 70, 68}, {257, 70, 69}, {125, 71, 2}, {126, 71, 4}, {128, 71, 5}, {146, 71, 29},
+    {147, 71, 31}, {149, 71, 32}, {166, 71, 56}, {167, 71, 58}, {169, 71, 59}, {185, 71, 83}, {186, 71, 85}, {188, 71, 86},
+    {218, 71, 13}, {219, 71, 15}, {238, 71, 40}, {239, 71, 42}, {255, 71, 67}, {256, 71, 69}, {125, 72, 3}, {127, 72, 5},
+    {146, 72, 30}, {148, 72, 32}, {166, 72, 57}, {168, 72, 59}, {185, 72, 84}, {187, 72, 86}, {218, 72, 14}, {238, 72, 41},
+    {255, 72, 68}, {125, 73, 4}, {126, 73, 5}, {146, 73, 31}, {147, 73, 32}, {166, 73, 58}, {167, 73, 59}, {185, 73, 85},
+    {186, 73, 86}, {218, 73, 15}, {238, 73, 42}, {255, 73, 69}, {125, 74, 5}, {146, 74, 32}, {166, 74, 59}, {185, 74, 86},
+    {207, 75, 109}, {227, 75, 16}, {244, 75, 43}, {258, 75, 70}, {124, 76, 1}, {145, 76, 28}, {165, 76, 55}, {184, 76, 82},
+    {226, 76, 16}, {227, 76, 17}, {244, 76, 44}, {258, 76, 71}, {123, 77, 1}, {124, 77, 2}, {145, 77, 29}, {165, 77, 56},
+    {184, 77, 83}, {207, 77, 110}, {225, 77, 16}, {226, 77, 17}, {122, 78, 1}, {123, 78, 2}, {144, 78, 28}, {224, 78, 16},
+    {225, 78, 17}, {243, 78, 43}, {122, 79, 2}, {144, 79, 29}, {224, 79, 17}, {243, 79, 44}, {124, 80, 3}, {145, 80, 30},
+    {165, 80, 57}, {184, 80, 84}, {223, 80, 16}, {227, 80, 18}, {242, 80, 43}, {244, 80, 45}, {258, 80, 72}, {121, 81, 1},
+    {123, 81, 3}, {124, 81, 4}, {143, 81, 28}, {145, 81, 31}, {164, 81, 55}, {165, 81, 58}, {184, 81, 85}, {222, 81, 16},
+    {223, 81, 17}, {226, 81, 18}, {242, 81, 44}, {120, 82, 1}, {121, 82, 2}, {122, 82, 3}, {123, 82, 4}, {142, 82, 28},
+    {143, 82, 29}, {144, 82, 30}, {163, 82, 55}, {164, 82, 56}, {183, 82, 82}, {221, 82, 16}, {222, 82, 17}, {225, 82, 18},
+    {241, 82, 43}, {120, 83, 2}, {122, 83, 4}, {142, 83, 29}, {144, 83, 31}, {163, 83, 56}, {183, 83, 83}, {221, 83, 17},
+    {224, 83, 18}, {241, 83, 44}, {243, 83, 45}, {121, 84, 3}, {124, 84, 5}, {143, 84, 30}, {145, 84, 32}, {164, 84, 57},
+    {165, 84, 59}, {184, 84, 86}, {206, 84, 109}, {207, 84, 111}, {220, 84, 16}, {223, 84, 18}, {240, 84, 43}, {242, 84, 45},
+    {257, 84, 70}, {119, 85, 1}, {120, 85, 3}, {121, 85, 4}, {123, 85, 5}, {141, 85, 28}, {142, 85, 30}, {143, 85, 31},
+    {162, 85, 55}, {163, 85, 57}, {164, 85, 58}, {182, 85, 82}, {183, 85, 84}, {219, 85, 16}, {220, 85, 17}, {222, 85, 18},
+    {239, 85, 43}, {240, 85, 44}, {256, 85, 70}, {257, 85, 71}, {119, 86, 2}, {120, 86, 4}, {122, 86, 5}, {141, 86, 29},
+    {142, 86, 31}, {144, 86, 32}, {162, 86, 56}, {163, 86, 58}, {182, 86, 83}, {183, 86, 85}, {206, 86, 110}, {219, 86, 17},
+    {221, 86, 18}, {239, 86, 44}, {241, 86, 45}, {256, 86, 71}, {119, 87, 3}, {121, 87, 5}, {141, 87, 30}, {143, 87, 32},
+    {162, 87, 57}, {164, 87, 59}, {182, 87, 84}, {218, 87, 16}, {220, 87, 18}, {238, 87, 43}, {240, 87, 45}, {255, 87, 70},
+    {257, 87, 72}, {119, 88, 4}, {120, 88, 5}, {141, 88, 31}, {142, 88, 32}, {162, 88, 58}, {163, 88, 59}, {182, 88, 85},
+    {183, 88, 86}, {218, 88, 17}, {219, 88, 18}, {238, 88, 44}, {239, 88, 45}, {255, 88, 71}, {256, 88, 72}, {119, 89, 5},
+    {141, 89, 32}, {162, 89, 59}, {182, 89, 86}, {206, 89, 111}, {218, 89, 18}, {238, 89, 45}, {255, 89, 72}, {130, 90, 6},
+    {134, 90, 8}, {151, 90, 33}, {155, 90, 35}, {171, 90, 60}, {175, 90, 62}, {190, 90, 87}, {194, 90, 89}, {213, 90, 11},
+    {217, 90, 14}, {233, 90, 38}, {237, 90, 41}, {250, 90, 65}, {254, 90, 68}, {264, 90, 92}, {268, 90, 95}, {129, 91, 6},
+    {130, 91, 7}, {133, 91, 8}, {134, 91, 9}, {150, 91, 33}, {151, 91, 34}, {154, 91, 35}, {155, 91, 36}, {170, 91, 60},
+    {171, 91, 61}, {174, 91, 62}, {175, 91, 63}, {189, 91, 87}, {190, 91, 88}, {193, 91, 89}, {194, 91, 90}, {212, 91, 11},
+    {213, 91, 12}, {216, 91, 14}, {217, 91, 15}, {232, 91, 38}, {233, 91, 39}, {236, 91, 41}, {237, 91, 42}, {249, 91, 65},
+    {250, 91, 66}, {253, 91, 68}, {254, 91, 69}, {263, 91, 92}, {264, 91, 93}, {267, 91, 95}, {268, 91, 96}, {128, 92, 6},
+    {129, 92, 7}, {132, 92, 8}, {133, 92, 9}, {149, 92, 33}, {150, 92, 34}, {153, 92, 35}, {154, 92, 36}, {169, 92, 60},
+    {170, 92, 61}, {173, 92, 62}, {174, 92, 63}, {188, 92, 87}, {189, 92, 88}, {192, 92, 89}, {193, 92, 90}, {211, 92, 11},
+    {212, 92, 12}, {213, 92, 13}, {215, 92, 14}, {216, 92, 15}, {231, 92, 38}, {232, 92, 39}, {233, 92, 40}, {235, 92, 41},
+    {236, 92, 42}, {248, 92, 65}, {249, 92, 66}, {250, 92, 67}, {252, 92, 68}, {253, 92, 69}, {262, 92, 92}, {263, 92, 93},
+    {264, 92, 94}, {266, 92, 95}, {267, 92, 96}, {128, 93, 7}, {131, 93, 8}, {132, 93, 9}, {149, 93, 34}, {152, 93, 35},
+    {153, 93, 36}, {169, 93, 61}, {172, 93, 62}, {173, 93, 63}, {188, 93, 88}, {191, 93, 89}, {192, 93, 90}, {211, 93, 12},
+    {212, 93, 13}, {214, 93, 14}, {215, 93, 15}, {231, 93, 39}, {232, 93, 40}, {234, 93, 41}, {235, 93, 42}, {248, 93, 66},
+    {249, 93, 67}, {251, 93, 68}, {252, 93, 69}, {262, 93, 93}, {263, 93, 94}, {265, 93, 95}, {266, 93, 96}, {131, 94, 9},
+    {152, 94, 36}, {172, 94, 63}, {191, 94, 90}, {211, 94, 13}, {214, 94, 15}, {231, 94, 40}, {234, 94, 42}, {248, 94, 67},
+    {251, 94, 69}, {262, 94, 94}, {265, 94, 96}, {127, 95, 6}, {130, 95, 8}, {134, 95, 10}, {148, 95, 33}, {151, 95, 35},
+    {155, 95, 37}, {168, 95, 60}, {171, 95, 62}, {175, 95, 64}, {187, 95, 87}, {190, 95, 89}, {194, 95, 91}, {205, 95, 109},
+    {210, 95, 11}, {213, 95, 14}, {230, 95, 38}, {233, 95, 41}, {247, 95, 65}, {250, 95, 68}, {261, 95, 92}, {264, 95, 95},
+    {126, 96, 6}, {127, 96, 7}, {129, 96, 8}, {130, 96, 9}, {133, 96, 10}, {147, 96, 33}, {148, 96, 34}, {150, 96, 35},
+    {151, 96, 36}, {154, 96, 37}, {167, 96, 60}, {168, 96, 61}, {170, 96, 62}, {171, 96, 63}, {174, 96, 64}, {186, 96, 87},
+    {187, 96, 88}, {189, 96, 89}, {190, 96, 90}, {193, 96, 91}, {204, 96, 109}, {209, 96, 11}, {210, 96, 12}, {212, 96, 14},
+    {213, 96, 15}, {229, 96, 38}, {230, 96, 39}, {232, 96, 41}, {233, 96, 42}, {246, 96, 65}, {247, 96, 66}, {249, 96, 68},
+    {250, 96, 69}, {260, 96, 92}, {261, 96, 93}, {263, 96, 95}, {264, 96, 96}, {126, 97, 7}, {128, 97, 8}, {129, 97, 9},
+    {132, 97, 10}, {147, 97, 34}, {149, 97, 35}, {150, 97, 36}, {153, 97, 37}, {167, 97, 61}, {169, 97, 62}, {170, 97, 63},
+    {173, 97, 64}, {186, 97, 88}, {188, 97, 89}, {189, 97, 90}, {192, 97, 91}, {205, 97, 110}, {209, 97, 12}, {210, 97, 13},
+    {211, 97, 14}, {212, 97, 15}, {229, 97, 39}, {230, 97, 40}, {231, 97, 41}, {232, 97, 42}, {246, 97, 66}, {247, 97, 67},
+    {248, 97, 68}, {249, 97, 69}, {260, 97, 93}, {261, 97, 94}, {262, 97, 95}, {263, 97, 96}, {128, 98, 9}, {131, 98, 10},
+    {149, 98, 36}, {152, 98, 37}, {169, 98, 63}, {172, 98, 64}, {188, 98, 90}, {191, 98, 91}, {204, 98, 110}, {209, 98, 13},
+    {211, 98, 15}, {229, 98, 40}, {231, 98, 42}, {246, 98, 67}, {248, 98, 69}, {260, 98, 94}, {262, 98, 96}, {125, 99, 6},
+    {127, 99, 8}, {130, 99, 10}, {146, 99, 33}, {148, 99, 35}, {151, 99, 37}, {166, 99, 60}, {168, 99, 62}, {171, 99, 64},
+    {185, 99, 87}, {187, 99, 89}, {190, 99, 91}, {203, 99, 109}, {208, 99, 11}, {210, 99, 14}, {228, 99, 38}, {230, 99, 41},
+    {245, 99, 65}, {247, 99, 68}, {259, 99, 92}, {261, 99, 95}, {125, 100, 7}, {126, 100, 8}, {127, 100, 9}, {129, 100, 10},
+    {146, 100, 34}, {147, 100, 35}, {148, 100, 36}, {150, 100, 37}, {166, 100, 61}, {167, 100, 62}, {168, 100, 63}, {170, 100, 64},
+    {185, 100, 88}, {186, 100, 89}, {187, 100, 90}, {189, 100, 91}, {208, 100, 12}, {209, 100, 14}, {210, 100, 15}, {228, 100, 39},
+    {229, 100, 41}, {230, 100, 42}, {245, 100, 66}, {246, 100, 68}, {247, 100, 69}, {259, 100, 93}, {260, 100, 95}, {261, 100, 96},
+    {126, 101, 9}, {128, 101, 10}, {147, 101, 36}, {149, 101, 37}, {167, 101, 63}, {169, 101, 64}, {186, 101, 90}, {188, 101, 91},
+    {203, 101, 110}, {208, 101, 13}, {209, 101, 15}, {228, 101, 40}, {229, 101, 42}, {245, 101, 67}, {246, 101, 69}, {259, 101, 94},
+    {260, 101, 96}, {125, 102, 8}, {127, 102, 10}, {146, 102, 35}, {148, 102, 37}, {166, 102, 62}, {168, 102, 64}, {185, 102, 89},
+    {187, 102, 91}, {205, 102, 111}, {208, 102, 14}, {228, 102, 41}, {245, 102, 68}, {259, 102, 95}, {125, 103, 9}, {126, 103, 10},
+    {146, 103, 36}, {147, 103, 37}, {166, 103, 63}, {167, 103, 64}, {185, 103, 90}, {186, 103, 91}, {204, 103, 111}, {208, 103, 15},
+    {228, 103, 42}, {245, 103, 69}, {259, 103, 96}, {125, 104, 10}, {146, 104, 37}, {166, 104, 64}, {185, 104, 91}, {203, 104, 111},
+    {124, 105, 6}, {145, 105, 33}, {165, 105, 60}, {184, 105, 87}, {202, 105, 109}, {217, 105, 16}, {227, 105, 19}, {237, 105, 43},
+    {244, 105, 46}, {254, 105, 70}, {258, 105, 73}, {268, 105, 97}, {118, 106, 1}, {123, 106, 6}, {124, 106, 7}, {140, 106, 28},
+    {145, 106, 34}, {161, 106, 55}, {165, 106, 61}, {181, 106, 82}, {184, 106, 88}, {216, 106, 16}, {217, 106, 17}, {226, 106, 19},
+    {227, 106, 20}, {236, 106, 43}, {237, 106, 44}, {244, 106, 47}, {253, 106, 70}, {254, 106, 71}, {258, 106, 74}, {267, 106, 97},
+    {268, 106, 98}, {117, 107, 1}, {118, 107, 2}, {122, 107, 6}, {123, 107, 7}, {139, 107, 28}, {140, 107, 29}, {144, 107, 33},
+    {160, 107, 55}, {161, 107, 56}, {180, 107, 82}, {181, 107, 83}, {202, 107, 110}, {215, 107, 16}, {216, 107, 17}, {225, 107, 19},
+    {226, 107, 20}, {235, 107, 43}, {236, 107, 44}, {252, 107, 70}, {253, 107, 71}, {266, 107, 97}, {267, 107, 98}, {116, 108, 1},
+    {117, 108, 2}, {122, 108, 7}, {138, 108, 28}, {139, 108, 29}, {144, 108, 34}, {159, 108, 55}, {160, 108, 56}, {179, 108, 82},
+    {180, 108, 83}, {214, 108, 16}, {215, 108, 17}, {224, 108, 19}, {225, 108, 20}, {234, 108, 43}, {235, 108, 44}, {243, 108, 46},
+    {251, 108, 70}, {252, 108, 71}, {265, 108, 97}, {266, 108, 98}, {116, 109, 2}, {138, 109, 29}, {159, 109, 56}, {179, 109, 83},
+    {214, 109, 17}, {224, 109, 20}, {234, 109, 44}, {243, 109, 47}, {251, 109, 71}, {265, 109, 98}, {118, 110, 3}, {121, 110, 6},
+    {124, 110, 8}, {140, 110, 30}, {143, 110, 33}, {145, 110, 35}, {161, 110, 57}, {164, 110, 60}, {165, 110, 62}, {181, 110, 84},
+    {184, 110, 89}, {213, 110, 16}, {217, 110, 18}, {223, 110, 19}, {227, 110, 21}, {233, 110, 43}, {237, 110, 45}, {242, 110, 46},
+    {244, 110, 48}, {250, 110, 70}, {254, 110, 72}, {258, 110, 75}, {264, 110, 97}, {268, 110, 99}, {115, 111, 1}, {117, 111, 3},
+    {118, 111, 4}, {120, 111, 6}, {121, 111, 7}, {123, 111, 8}, {124, 111, 9}, {137, 111, 28}, {139, 111, 30}, {140, 111, 31},
+    {142, 111, 33}, {143, 111, 34}, {145, 111, 36}, {158, 111, 55}, {160, 111, 57}, {161, 111, 58}, {163, 111, 60}, {164, 111, 61},
+    {165, 111, 63}, {178, 111, 82}, {180, 111, 84}, {181, 111, 85}, {183, 111, 87}, {184, 111, 90}, {212, 111, 16}, {213, 111, 17},
+    {216, 111, 18}, {222, 111, 19}, {223, 111, 20}, {226, 111, 21}, {232, 111, 43}, {233, 111, 44}, {236, 111, 45}, {242, 111, 47},
+    {249, 111, 70}, {250, 111, 71}, {253, 111, 72}, {263, 111, 97}, {264, 111, 98}, {267, 111, 99}, {114, 112, 1}, {115, 112, 2},
+    {116, 112, 3}, {117, 112, 4}, {120, 112, 7}, {122, 112, 8}, {123, 112, 9}, {136, 112, 28}, {137, 112, 29}, {138, 112, 30},
+    {139, 112, 31}, {142, 112, 34}, {144, 112, 35}, {157, 112, 55}, {158, 112, 56}, {159, 112, 57}, {160, 112, 58}, {163, 112, 61},
+    {177, 112, 82}, {178, 112, 83}, {179, 112, 84}, {180, 112, 85}, {183, 112, 88}, {211, 112, 16}, {212, 112, 17}, {215, 112, 18},
+    {221, 112, 19}, {222, 112, 20}, {225, 112, 21}, {231, 112, 43}, {232, 112, 44}, {235, 112, 45}, {241, 112, 46}, {248, 112, 70},
+    {249, 112, 71}, {252, 112, 72}, {262, 112, 97}, {263, 112, 98}, {266, 112, 99}, {114, 113, 2}, {116, 113, 4}, {122, 113, 9},
+    {136, 113, 29}, {138, 113, 31}, {144, 113, 36}, {157, 113, 56}, {159, 113, 58}, {177, 113, 83}, {179, 113, 85}, {211, 113, 17},
+    {214, 113, 18}, {221, 113, 20}, {224, 113, 21}, {231, 113, 44}, {234, 113, 45}, {241, 113, 47}, {243, 113, 48}, {248, 113, 71},
+    {251, 113, 72}, {262, 113, 98}, {265, 113, 99}, {115, 114, 3}, {118, 114, 5}, {119, 114, 6}, {121, 114, 8}, {124, 114, 10},
+    {137, 114, 30}, {140, 114, 32}, {141, 114, 33}, {143, 114, 35}, {145, 114, 37}, {158, 114, 57}, {161, 114, 59}, {162, 114, 60},
+    {164, 114, 62}, {165, 114, 64}, {178, 114, 84}, {181, 114, 86}, {182, 114, 87}, {184, 114, 91}, {201, 114, 109}, {202, 114, 111},
+    {210, 114, 16}, {213, 114, 18}, {220, 114, 19}, {223, 114, 21}, {230, 114, 43}, {233, 114, 45}, {240, 114, 46}, {242, 114, 48},
+    {247, 114, 70}, {250, 114, 72}, {257, 114, 73}, {261, 114, 97}, {264, 114, 99}, {113, 115, 1}, {114, 115, 3}, {115, 115, 4},
+    {117, 115, 5}, {119, 115, 7}, {120, 115, 8}, {121, 115, 9}, {123, 115, 10}, {135, 115, 28}, {136, 115, 30}, {137, 115, 31},
+    {139, 115, 32}, {141, 115, 34}, {142, 115, 35}, {143, 115, 36}, {156, 115, 55}, {157, 115, 57}, {158, 115, 58}, {160, 115, 59},
+    {162, 115, 61}, {163, 115, 62}, {164, 115, 63}, {176, 115, 82}, {177, 115, 84}, {178, 115, 85}, {180, 115, 86}, {182, 115, 88},
+    {183, 115, 89}, {209, 115, 16}, {210, 115, 17}, {212, 115, 18}, {219, 115, 19}, {220, 115, 20}, {222, 115, 21}, {229, 115, 43},
+    {230, 115, 44}, {232, 115, 45}, {239, 115, 46}, {240, 115, 47}, {246, 115, 70}, {247, 115, 71}, {249, 115, 72}, {256, 115, 73},
+    {257, 115, 74}, {260, 115, 97}, {261, 115, 98}, {263, 115, 99}, {113, 116, 2}, {114, 116, 4}, {116, 116, 5}, {120, 116, 9},
+    {122, 116, 10}, {135, 116, 29}, {136, 116, 31}, {138, 116, 32}, {142, 116, 36}, {144, 116, 37}, {156, 116, 56}, {157, 116, 58},
+    {159, 116, 59}, {163, 116, 63}, {176, 116, 83}, {177, 116, 85}, {179, 116, 86}, {183, 116, 90}, {201, 116, 110}, {209, 116, 17},
+    {211, 116, 18}, {219, 116, 20}, {221, 116, 21}, {229, 116, 44}, {231, 116, 45}, {239, 116, 47}, {241, 116, 48}, {246, 116, 71},
+    {248, 116, 72}, {256, 116, 74}, {260, 116, 98}, {262, 116, 99}, {113, 117, 3}, {115, 117, 5}, {119, 117, 8}, {121, 117, 10},
+    {135, 117, 30}, {137, 117, 32}, {141, 117, 35}, {143, 117, 37}, {156, 117, 57}, {158, 117, 59}, {162, 117, 62}, {164, 117, 64},
+    {176, 117, 84}, {178, 117, 86}, {182, 117, 89}, {208, 117, 16}, {210, 117, 18}, {218, 117, 19}, {220, 117, 21}, {228, 117, 43},
+    {230, 117, 45}, {238, 117, 46}, {240, 117, 48}, {245, 117, 70}, {247, 117, 72}, {255, 117, 73}, {257, 117, 75}, {259, 117, 97},
+    {261, 117, 99}, {113, 118, 4}, {114, 118, 5}, {119, 118, 9}, {120, 118, 10}, {135, 118, 31}, {136, 118, 32}, {141, 118, 36},
+    {142, 118, 37}, {156, 118, 58}, {157, 118, 59}, {162, 118, 63}, {163, 118, 64}, {176, 118, 85}, {177, 118, 86}, {182, 118, 90},
+    {183, 118, 91}, {208, 118, 17}, {209, 118, 18}, {218, 118, 20}, {219, 118, 21}, {228, 118, 44}, {229, 118, 45}, {238, 118, 47},
+    {239, 118, 48}, {245, 118, 71}, {246, 118, 72}, {255, 118, 74}, {256, 118, 75}, {259, 118, 98}, {260, 118, 99}, {113, 119, 5},
+    {119, 119, 10}, {135, 119, 32}, {141, 119, 37}, {156, 119, 59}, {162, 119, 64}, {176, 119, 86}, {182, 119, 91}, {201, 119, 111},
+    {208, 119, 18}, {218, 119, 21}, {228, 119, 45}, {238, 119, 48}, {245, 119, 72}, {255, 119, 75}, {259, 119, 99}, {118, 120, 6},
+    {140, 120, 33}, {161, 120, 60}, {181, 120, 87}, {200, 120, 109}, {217, 120, 19}, {237, 120, 46}, {254, 120, 73}, {268, 120, 100},
+    {117, 121, 6}, {118, 121, 7}, {139, 121, 33}, {140, 121, 34}, {160, 121, 60}, {161, 121, 61}, {180, 121, 87}, {181, 121, 88},
+    {199, 121, 109}, {216, 121, 19}, {217, 121, 20}, {236, 121, 46}, {237, 121, 47}, {253, 121, 73}, {254, 121, 74}, {267, 121, 100},
+    {268, 121, 101}, {116, 122, 6}, {117, 122, 7}, {138, 122, 33}, {139, 122, 34}, {159, 122, 60}, {160, 122, 61}, {179, 122, 87},
+    {180, 122, 88}, {198, 122, 109}, {200, 122, 110}, {215, 122, 19}, {216, 122, 20}, {235, 122, 46}, {236, 122, 47}, {252, 122, 73},
+    {253, 122, 74}, {266, 122, 100}, {267, 122, 101}, {115, 123, 6}, {118, 123, 8}, {137, 123, 33}, {140, 123, 35}, {158, 123, 60},
+    {161, 123, 62}, {178, 123, 87}, {181, 123, 89}, {197, 123, 109}, {213, 123, 19}, {217, 123, 21}, {233, 123, 46}, {237, 123, 48},
+    {250, 123, 73}, {254, 123, 75}, {264, 123, 100}, {268, 123, 102}, {114, 124, 6}, {115, 124, 7}, {117, 124, 8}, {118, 124, 9},
+    {136, 124, 33}, {137, 124, 34}, {139, 124, 35}, {140, 124, 36}, {157, 124, 60}, {158, 124, 61}, {160, 124, 62}, {161, 124, 63},
+    {177, 124, 87}, {178, 124, 88}, {180, 124, 89}, {181, 124, 90}, {196, 124, 109}, {212, 124, 19}, {213, 124, 20}, {216, 124, 21},
+    {232, 124, 46}, {233, 124, 47}, {236, 124, 48}, {249, 124, 73}, {250, 124, 74}, {253, 124, 75}, {263, 124, 100}, {264, 124, 101},
+    {267, 124, 102}, {114, 125, 7}, {116, 125, 8}, {117, 125, 9}, {136, 125, 34}, {138, 125, 35}, {139, 125, 36}, {157, 125, 61},
+    {159, 125, 62}, {160, 125, 63}, {177, 125, 88}, {179, 125, 89}, {180, 125, 90}, {197, 125, 110}, {211, 125, 19}, {212, 125, 20},
+    {215, 125, 21}, {231, 125, 46}, {232, 125, 47}, {235, 125, 48}, {248, 125, 73}, {249, 125, 74}, {252, 125, 75}, {262, 125, 100},
+    {263, 125, 101}, {266, 125, 102}, {116, 126, 9}, {138, 126, 36}, {159, 126, 63}, {179, 126, 90}, {196, 126, 110}, {211, 126, 20},
+    {214, 126, 21}, {231, 126, 47}, {234, 126, 48}, {248, 126, 74}, {251, 126, 75}, {262, 126, 101}, {265, 126, 102}, {113, 127, 6},
+    {115, 127, 8}, {118, 127, 10}, {135, 127, 33}, {137, 127, 35}, {140, 127, 37}, {156, 127, 60}, {158, 127, 62}, {161, 127, 64},
+    {176, 127, 87}, {178, 127, 89}, {181, 127, 91}, {195, 127, 109}, {200, 127, 111}, {210, 127, 19}, {213, 127, 21}, {230, 127, 46},
+    {233, 127, 48}, {247, 127, 73}, {250, 127, 75}, {261, 127, 100}, {264, 127, 102}, {113, 128, 7}, {114, 128, 8}, {115, 128, 9},
+    {117, 128, 10}, {135, 128, 34}, {136, 128, 35}, {137, 128, 36}, {139, 128, 37}, {156, 128, 61}, {157, 128, 62}, {158, 128, 63},
+    {160, 128, 64}, {176, 128, 88}, {177, 128, 89}, {178, 128, 90}, {180, 128, 91}, {199, 128, 111}, {209, 128, 19}, {210, 128, 20},
+    {212, 128, 21}, {229, 128, 46}, {230, 128, 47}, {232, 128, 48}, {246, 128, 73}, {247, 128, 74}, {249, 128, 75}, {260, 128, 100},
+    {261, 128, 101}, {263, 128, 102}, {114, 129, 9}, {116, 129, 10}, {136, 129, 36}, {138, 129, 37}, {157, 129, 63}, {159, 129, 64},
+    {177, 129, 90}, {179, 129, 91}, {195, 129, 110}, {198, 129, 111}, {209, 129, 20}, {211, 129, 21}, {229, 129, 47}, {231, 129, 48},
+    {246, 129, 74}, {248, 129, 75}, {260, 129, 101}, {262, 129, 102}, {113, 130, 8}, {115, 130, 10}, {135, 130, 35}, {137, 130, 37},
+    {156, 130, 62}, {158, 130, 64}, {176, 130, 89}, {178, 130, 91}, {197, 130, 111}, {208, 130, 19}, {210, 130, 21}, {228, 130, 46},
+    {230, 130, 48}, {245, 130, 73}, {247, 130, 75}, {259, 130, 100}, {261, 130, 102}, {113, 131, 9}, {114, 131, 10}, {135, 131, 36},
+    {136, 131, 37}, {156, 131, 63}, {157, 131, 64}, {176, 131, 90}, {177, 131, 91}, {196, 131, 111}, {208, 131, 20}, {209, 131, 21},
+    {228, 131, 47}, {229, 131, 48}, {245, 131, 74}, {246, 131, 75}, {259, 131, 101}, {260, 131, 102}, {113, 132, 10}, {135, 132, 37},
+    {156, 132, 64}, {176, 132, 91}, {195, 132, 111}, {208, 132, 21}, {228, 132, 48}, {245, 132, 75}, {259, 132, 102}, {112, 133, 109},
+    {129, 133, 11}, {130, 133, 12}, {133, 133, 14}, {134, 133, 15}, {150, 133, 38}, {151, 133, 39}, {154, 133, 41}, {155, 133, 42},
+    {170, 133, 65}, {171, 133, 66}, {174, 133, 68}, {175, 133, 69}, {189, 133, 92}, {190, 133, 93}, {193, 133, 95}, {194, 133, 96},
+    {111, 134, 109}, {128, 134, 11}, {129, 134, 12}, {130, 134, 13}, {132, 134, 14}, {133, 134, 15}, {149, 134, 38}, {150, 134, 39},
+    {151, 134, 40}, {153, 134, 41}, {154, 134, 42}, {169, 134, 65}, {170, 134, 66}, {171, 134, 67}, {173, 134, 68}, {174, 134, 69},
+    {188, 134, 92}, {189, 134, 93}, {190, 134, 94}, {192, 134, 95}, {193, 134, 96}, {110, 135, 109}, {126, 135, 11}, {127, 135, 12},
+    {129, 135, 14}, {130, 135, 15}, {147, 135, 38}, {148, 135, 39}, {150, 135, 41}, {151, 135, 42}, {167, 135, 65}, {168, 135, 66},
+    {170, 135, 68}, {171, 135, 69}, {186, 135, 92}, {187, 135, 93}, {189, 135, 95}, {190, 135, 96}, {109, 136, 109}, {124, 136, 11},
+    {134, 136, 16}, {145, 136, 38}, {155, 136, 43}, {165, 136, 65}, {175, 136, 70}, {184, 136, 92}, {194, 136, 97}, {227, 136, 22},
+    {244, 136, 49}, {258, 136, 76}, {56, 137, 1}, {68, 137, 28}, {80, 137, 55}, {92, 137, 82}, {123, 137, 11}, {124, 137, 12},
+    {133, 137, 16}, {134, 137, 17}, {145, 137, 39}, {154, 137, 43}, {155, 137, 44}, {165, 137, 66}, {174, 137, 70}, {175, 137, 71},
+    {184, 137, 93}, {193, 137, 97}, {194, 137, 98}, {226, 137, 22}, {227, 137, 23}, {244, 137, 50}, {258, 137, 77}, {55, 138, 1},
+    {56, 138, 2}, {67, 138, 28}, {68, 138, 29}, {79, 138, 55}, {80, 138, 56}, {91, 138, 82}, {92, 138, 83}, {109, 138, 110},
+    {122, 138, 11}, {123, 138, 12}, {124, 138, 13}, {132, 138, 16}, {133, 138, 17}, {144, 138, 38}, {145, 138, 40}, {153, 138, 43},
+    {154, 138, 44}, {165, 138, 67}, {173, 138, 70}, {174, 138, 71}, {184, 138, 94}, {192, 138, 97}, {193, 138, 98}, {225, 138, 22},
+    {226, 138, 23}, {54, 139, 1}, {55, 139, 2}, {66, 139, 28}, {67, 139, 29}, {78, 139, 55}, {79, 139, 56}, {90, 139, 82},
+    {91, 139, 83}, {122, 139, 12}, {123, 139, 13}, {131, 139, 16}, {132, 139, 17}, {144, 139, 39}, {152, 139, 43}, {153, 139, 44},
+    {172, 139, 70}, {173, 139, 71}, {191, 139, 97}, {192, 139, 98}, {224, 139, 22}, {225, 139, 23}, {243, 139, 49}, {54, 140, 2},
+    {66, 140, 29}, {78, 140, 56}, {90, 140, 83}, {122, 140, 13}, {131, 140, 17}, {144, 140, 40}, {152, 140, 44}, {172, 140, 71},
+    {191, 140, 98}, {224, 140, 23}, {243, 140, 50}, {56, 141, 3}, {68, 141, 30}, {80, 141, 57}, {92, 141, 84}, {121, 141, 11},
+    {124, 141, 14}, {130, 141, 16}, {134, 141, 18}, {143, 141, 38}, {145, 141, 41}, {151, 141, 43}, {155, 141, 45}, {164, 141, 65},
+    {165, 141, 68}, {171, 141, 70}, {175, 141, 72}, {184, 141, 95}, {190, 141, 97}, {194, 141, 99}, {223, 141, 22}, {227, 141, 24},
+    {242, 141, 49}, {244, 141, 51}, {258, 141, 78}, {53, 142, 1}, {55, 142, 3}, {56, 142, 4}, {65, 142, 28}, {67, 142, 30},
+    {68, 142, 31}, {77, 142, 55}, {79, 142, 57}, {80, 142, 58}, {89, 142, 82}, {91, 142, 84}, {92, 142, 85}, {120, 142, 11},
+    {121, 142, 12}, {123, 142, 14}, {124, 142, 15}, {129, 142, 16}, {130, 142, 17}, {133, 142, 18}, {142, 142, 38}, {143, 142, 39},
+    {145, 142, 42}, {150, 142, 43}, {151, 142, 44}, {154, 142, 45}, {163, 142, 65}, {164, 142, 66}, {165, 142, 69}, {170, 142, 70},
+    {171, 142, 71}, {174, 142, 72}, {183, 142, 92}, {184, 142, 96}, {189, 142, 97}, {190, 142, 98}, {193, 142, 99}, {222, 142, 22},
+    {223, 142, 23}, {226, 142, 24}, {242, 142, 50}, {52, 143, 1}, {53, 143, 2}, {54, 143, 3}, {55, 143, 4}, {64, 143, 28},
+    {65, 143, 29}, {66, 143, 30}, {67, 143, 31}, {76, 143, 55}, {77, 143, 56}, {78, 143, 57}, {79, 143, 58}, {88, 143, 82},
+    {89, 143, 83}, {90, 143, 84}, {91, 143, 85}, {120, 143, 12}, {121, 143, 13}, {122, 143, 14}, {123, 143, 15}, {128, 143, 16},
+    {129, 143, 17}, {132, 143, 18}, {142, 143, 39}, {143, 143, 40}, {144, 143, 41}, {149, 143, 43}, {150, 143, 44}, {153, 143, 45},
+    {163, 143, 66}, {164, 143, 67}, {169, 143, 70}, {170, 143, 71}, {173, 143, 72}, {183, 143, 93}, {188, 143, 97}, {189, 143, 98},
+    {192, 143, 99}, {221, 143, 22}, {222, 143, 23}, {225, 143, 24}, {241, 143, 49}, {52, 144, 2}, {54, 144, 4}, {64, 144, 29},
+    {66, 144, 31}, {76, 144, 56}, {78, 144, 58}, {88, 144, 83}, {90, 144, 85}, {120, 144, 13}, {122, 144, 15}, {128, 144, 17},
+    {131, 144, 18}, {142, 144, 40}, {144, 144, 42}, {149, 144, 44}, {152, 144, 45}, {163, 144, 67}, {169, 144, 71}, {172, 144, 72},
+    {183, 144, 94}, {188, 144, 98}, {191, 144, 99}, {221, 144, 23}, {224, 144, 24}, {241, 144, 50}, {243, 144, 51}, {53, 145, 3},
+    {56, 145, 5}, {65, 145, 30}, {68, 145, 32}, {77, 145, 57}, {80, 145, 59}, {89, 145, 84}, {92, 145, 86}, {108, 145, 109},
+    {109, 145, 111}, {119, 145, 11}, {121, 145, 14}, {127, 145, 16}, {130, 145, 18}, {141, 145, 38}, {143, 145, 41}, {148, 145, 43},
+    {151, 145, 45}, {162, 145, 65}, {164, 145, 68}, {168, 145, 70}, {171, 145, 72}, {182, 145, 92}, {187, 145, 97}, {190, 145, 99},
+    {220, 145, 22}, {223, 145, 24}, {240, 145, 49}, {242, 145, 51}, {257, 145, 76}, {51, 146, 1}, {52, 146, 3}, {53, 146, 4},
+    {55, 146, 5}, {63, 146, 28}, {64, 146, 30}, {65, 146, 31}, {67, 146, 32}, {75, 146, 55}, {76, 146, 57}, {77, 146, 58},
+    {79, 146, 59}, {87, 146, 82}, {88, 146, 84}, {89, 146, 85}, {91, 146, 86}, {119, 146, 12}, {120, 146, 14}, {121, 146, 15},
+    {126, 146, 16}, {127, 146, 17}, {129, 146, 18}, {141, 146, 39}, {142, 146, 41}, {143, 146, 42}, {147, 146, 43}, {148, 146, 44},
+    {150, 146, 45}, {162, 146, 66}, {163, 146, 68}, {164, 146, 69}, {167, 146, 70}, {168, 146, 71}, {170, 146, 72}, {182, 146, 93},
+    {183, 146, 95}, {186, 146, 97}, {187, 146, 98}, {189, 146, 99}, {219, 146, 22}, {220, 146, 23}, {222, 146, 24}, {239, 146, 49},
+    {240, 146, 50}, {256, 146, 76}, {257, 146, 77}, {51, 147, 2}, {52, 147, 4}, {54, 147, 5}, {63, 147, 29}, {64, 147, 31},
+    {66, 147, 32}, {75, 147, 56}, {76, 147, 58}, {78, 147, 59}, {87, 147, 83}, {88, 147, 85}, {90, 147, 86}, {108, 147, 110},
+    {119, 147, 13}, {120, 147, 15}, {126, 147, 17}, {128, 147, 18}, {141, 147, 40}, {142, 147, 42}, {147, 147, 44}, {149, 147, 45},
+    {162, 147, 67}, {163, 147, 69}, {167, 147, 71}, {169, 147, 72}, {182, 147, 94}, {183, 147, 96}, {186, 147, 98}, {188, 147, 99},
+    {219, 147, 23}, {221, 147, 24}, {239, 147, 50}, {241, 147, 51}, {256, 147, 77}, {51, 148, 3}, {53, 148, 5}, {63, 148, 30},
+    {65, 148, 32}, {75, 148, 57}, {77, 148, 59}, {87, 148, 84}, {89, 148, 86}, {119, 148, 14}, {125, 148, 16}, {127, 148, 18},
+    {141, 148, 41}, {146, 148, 43}, {148, 148, 45}, {162, 148, 68}, {166, 148, 70}, {168, 148, 72}, {182, 148, 95}, {185, 148, 97},
+    {187, 148, 99}, {218, 148, 22}, {220, 148, 24}, {238, 148, 49}, {240, 148, 51}, {255, 148, 76}, {257, 148, 78}, {51, 149, 4},
+    {52, 149, 5}, {63, 149, 31}, {64, 149, 32}, {75, 149, 58}, {76, 149, 59}, {87, 149, 85}, {88, 149, 86}, {119, 149, 15},
+    {125, 149, 17}, {126, 149, 18}, {141, 149, 42}, {146, 149, 44}, {147, 149, 45}, {162, 149, 69}, {166, 149, 71}, {167, 149, 72},
+    {182, 149, 96}, {185, 149, 98}, {186, 149, 99}, {218, 149, 23}, {219, 149, 24}, {238, 149, 50}, {239, 149, 51}, {255, 149, 77},
+    {256, 149, 78}, {51, 150, 5}, {63, 150, 32}, {75, 150, 59}, {87, 150, 86}, {108, 150, 111}, {125, 150, 18}, {146, 150, 45},
+    {166, 150, 72}, {185, 150, 99}, {218, 150, 24}, {238, 150, 51}, {255, 150, 78}, {107, 151, 109}, {124, 151, 16}, {145, 151, 43},
+    {165, 151, 70}, {184, 151, 97}, {227, 151, 25}, {244, 151, 52}, {258, 151, 79}, {50, 152, 1}, {62, 152, 28}, {74, 152, 55},
+    {86, 152, 82}, {106, 152, 109}, {123, 152, 16}, {124, 152, 17}, {145, 152, 44}, {165, 152, 71}, {184, 152, 98}, {226, 152, 25},
+    {49, 153, 1}, {50, 153, 2}, {61, 153, 28}, {62, 153, 29}, {73, 153, 55}, {74, 153, 56}, {85, 153, 82}, {86, 153, 83},
+    {107, 153, 110}, {122, 153, 16}, {123, 153, 17}, {144, 153, 43}, {225, 153, 25}, {49, 154, 2}, {61, 154, 29}, {73, 154, 56},
+    {85, 154, 83}, {106, 154, 110}, {122, 154, 17}, {144, 154, 44}, {224, 154, 25}, {243, 154, 52}, {50, 155, 3}, {62, 155, 30},
+    {74, 155, 57}, {86, 155, 84}, {105, 155, 109}, {121, 155, 16}, {124, 155, 18}, {143, 155, 43}, {145, 155, 45}, {164, 155, 70},
+    {165, 155, 72}, {184, 155, 99}, {223, 155, 25}, {242, 155, 52}, {48, 156, 1}, {49, 156, 3}, {50, 156, 4}, {60, 156, 28},
+    {61, 156, 30}, {62, 156, 31}, {72, 156, 55}, {73, 156, 57}, {74, 156, 58}, {84, 156, 82}, {85, 156, 84}, {86, 156, 85},
+    {120, 156, 16}, {121, 156, 17}, {123, 156, 18}, {142, 156, 43}, {143, 156, 44}, {163, 156, 70}, {164, 156, 71}, {183, 156, 97},
+    {222, 156, 25}, {48, 157, 2}, {49, 157, 4}, {60, 157, 29}, {61, 157, 31}, {72, 157, 56}, {73, 157, 58}, {84, 157, 83},
+    {85, 157, 85}, {105, 157, 110}, {120, 157, 17}, {122, 157, 18}, {142, 157, 44}, {144, 157, 45}, {163, 157, 71}, {183, 157, 98},
+    {221, 157, 25}, {241, 157, 52}, {48, 158, 3}, {50, 158, 5}, {60, 158, 30}, {62, 158, 32}, {72, 158, 57}, {74, 158, 59},
+    {84, 158, 84}, {86, 158, 86}, {107, 158, 111}, {119, 158, 16}, {121, 158, 18}, {141, 158, 43}, {143, 158, 45}, {162, 158, 70},
+    {164, 158, 72}, {182, 158, 97}, {220, 158, 25}, {240, 158, 52}, {257, 158, 79}, {48, 159, 4}, {49, 159, 5}, {60, 159, 31},
+    {61, 159, 32}, {72, 159, 58}, {73, 159, 59}, {84, 159, 85}, {85, 159, 86}, {106, 159, 111}, {119, 159, 17}, {120, 159, 18},
+    {141, 159, 44}, {142, 159, 45}, {162, 159, 71}, {163, 159, 72}, {182, 159, 98}, {183, 159, 99}, {219, 159, 25}, {239, 159, 52},
+    {256, 159, 79}, {48, 160, 5}, {60, 160, 32}, {72, 160, 59}, {84, 160, 86}, {105, 160, 111}, {119, 160, 18}, {141, 160, 45},
+    {162, 160, 72}, {182, 160, 99}, {218, 160, 25}, {238, 160, 52}, {255, 160, 79}, {56, 161, 6}, {68, 161, 33}, {80, 161, 60},
+    {92, 161, 87}, {104, 161, 109}, {118, 161, 11}, {134, 161, 19}, {140, 161, 38}, {155, 161, 46}, {161, 161, 65}, {175, 161, 73},
+    {181, 161, 92}, {194, 161, 100}, {217, 161, 22}, {237, 161, 49}, {254, 161, 76}, {268, 161, 103}, {55, 162, 6}, {56, 162, 7},
+    {67, 162, 33}, {68, 162, 34}, {79, 162, 60}, {80, 162, 61}, {91, 162, 87}, {92, 162, 88}, {103, 162, 109}, {117, 162, 11},
+    {118, 162, 12}, {133, 162, 19}, {134, 162, 20}, {139, 162, 38}, {140, 162, 39}, {154, 162, 46}, {155, 162, 47}, {160, 162, 65},
+    {161, 162, 66}, {174, 162, 73}, {175, 162, 74}, {180, 162, 92}, {181, 162, 93}, {193, 162, 100}, {194, 162, 101}, {216, 162, 22},
+    {217, 162, 23}, {236, 162, 49}, {237, 162, 50}, {253, 162, 76}, {254, 162, 77}, {267, 162, 103}, {268, 162, 104}, {54, 163, 6},
+    {55, 163, 7}, {66, 163, 33}, {67, 163, 34}, {78, 163, 60}, {79, 163, 61}, {90, 163, 87}, {91, 163, 88}, {102, 163, 109},
+    {104, 163, 110}, {116, 163, 11}, {117, 163, 12}, {118, 163, 13}, {132, 163, 19}, {133, 163, 20}, {138, 163, 38}, {139, 163, 39},
+    {140, 163, 40}, {153, 163, 46}, {154, 163, 47}, {159, 163, 65}, {160, 163, 66}, {161, 163, 67}, {173, 163, 73}, {174, 163, 74},
+    {179, 163, 92}, {180, 163, 93}, {181, 163, 94}, {192, 163, 100}, {193, 163, 101}, {215, 163, 22}, {216, 163, 23}, {235, 163, 49},
+    {236, 163, 50}, {252, 163, 76}, {253, 163, 77}, {266, 163, 103}, {267, 163, 104}, {53, 164, 6}, {56, 164, 8}, {65, 164, 33},
+    {68, 164, 35}, {77, 164, 60}, {80, 164, 62}, {89, 164, 87}, {92, 164, 89}, {101, 164, 109}, {115, 164, 11}, {118, 164, 14},
+    {130, 164, 19}, {134, 164, 21}, {137, 164, 38}, {140, 164, 41}, {151, 164, 46}, {155, 164, 48}, {158, 164, 65}, {161, 164, 68},
+    {171, 164, 73}, {175, 164, 75}, {178, 164, 92}, {181, 164, 95}, {190, 164, 100}, {194, 164, 102}, {213, 164, 22}, {217, 164, 24},
+    {233, 164, 49}, {237, 164, 51}, {250, 164, 76}, {254, 164, 78}, {264, 164, 103}, {268, 164, 105}, {52, 165, 6}, {53, 165, 7},
+    {55, 165, 8}, {56, 165, 9}, {64, 165, 33}, {65, 165, 34}, {67, 165, 35}, {68, 165, 36}, {76, 165, 60}, {77, 165, 61},
+    {79, 165, 62}, {80, 165, 63}, {88, 165, 87}, {89, 165, 88}, {91, 165, 89}, {92, 165, 90}, {100, 165, 109}, {114, 165, 11},
+    {115, 165, 12}, {117, 165, 14}, {118, 165, 15}, {129, 165, 19}, {130, 165, 20}, {133, 165, 21}, {136, 165, 38}, {137, 165, 39},
+    {139, 165, 41}, {140, 165, 42}, {150, 165, 46}, {151, 165, 47}, {154, 165, 48}, {157, 165, 65}, {158, 165, 66}, {160, 165, 68},
+    {161, 165, 69}, {170, 165, 73}, {171, 165, 74}, {174, 165, 75}, {177, 165, 92}, {178, 165, 93}, {180, 165, 95}, {181, 165, 96},
+    {189, 165, 100}, {190, 165, 101}, {193, 165, 102}, {212, 165, 22}, {213, 165, 23}, {216, 165, 24}, {232, 165, 49}, {233, 165, 50},
+    {236, 165, 51}, {249, 165, 76}, {250, 165, 77}, {253, 165, 78}, {263, 165, 103}, {264, 165, 104}, {267, 165, 105}, {52, 166, 7},
+    {54, 166, 8}, {55, 166, 9}, {64, 166, 34}, {66, 166, 35}, {67, 166, 36}, {76, 166, 61}, {78, 166, 62}, {79, 166, 63},
+    {88, 166, 88}, {90, 166, 89}, {91, 166, 90}, {101, 166, 110}, {114, 166, 12}, {115, 166, 13}, {116, 166, 14}, {117, 166, 15},
+    {128, 166, 19}, {129, 166, 20}, {132, 166, 21}, {136, 166, 39}, {137, 166, 40}, {138, 166, 41}, {139, 166, 42}, {149, 166, 46},
+    {150, 166, 47}, {153, 166, 48}, {157, 166, 66}, {158, 166, 67}, {159, 166, 68}, {160, 166, 69}, {169, 166, 73}, {170, 166, 74},
+    {173, 166, 75}, {177, 166, 93}, {178, 166, 94}, {179, 166, 95}, {180, 166, 96}, {188, 166, 100}, {189, 166, 101}, {192, 166, 102},
+    {211, 166, 22}, {212, 166, 23}, {215, 166, 24}, {231, 166, 49}, {232, 166, 50}, {235, 166, 51}, {248, 166, 76}, {249, 166, 77},
+    {252, 166, 78}, {262, 166, 103}, {263, 166, 104}, {266, 166, 105}, {54, 167, 9}, {66, 167, 36}, {78, 167, 63}, {90, 167, 90},
+    {100, 167, 110}, {114, 167, 13}, {116, 167, 15}, {128, 167, 20}, {131, 167, 21}, {136, 167, 40}, {138, 167, 42}, {149, 167, 47},
+    {152, 167, 48}, {157, 167, 67}, {159, 167, 69}, {169, 167, 74}, {172, 167, 75}, {177, 167, 94}, {179, 167, 96}, {188, 167, 101},
+    {191, 167, 102}, {211, 167, 23}, {214, 167, 24}, {231, 167, 50}, {234, 167, 51}, {248, 167, 77}, {251, 167, 78}, {262, 167, 104},
+    {265, 167, 105}, {51, 168, 6}, {53, 168, 8}, {56, 168, 10}, {63, 168, 33}, {65, 168, 35}, {68, 168, 37}, {75, 168, 60},
+    {77, 168, 62}, {80, 168, 64}, {87, 168, 87}, {89, 168, 89}, {92, 168, 91}, {99, 168, 109}, {104, 168, 111}, {113, 168, 11},
+    {115, 168, 14}, {127, 168, 19}, {130, 168, 21}, {135, 168, 38}, {137, 168, 41}, {148, 168, 46}, {151, 168, 48}, {156, 168, 65},
+    {158, 168, 68}, {168, 168, 73}, {171, 168, 75}, {176, 168, 92}, {178, 168, 95}, {187, 168, 100}, {190, 168, 102}, {210, 168, 22},
+    {213, 168, 24}, {230, 168, 49}, {233, 168, 51}, {247, 168, 76}, {250, 168, 78}, {261, 168, 103}, {264, 168, 105}, {51, 169, 7},
+    {52, 169, 8}, {53, 169, 9}, {55, 169, 10}, {63, 169, 34}, {64, 169, 35}, {65, 169, 36}, {67, 169, 37}, {75, 169, 61},
+    {76, 169, 62}, {77, 169, 63}, {79, 169, 64}, {87, 169, 88}, {88, 169, 89}, {89, 169, 90}, {91, 169, 91}, {103, 169, 111},
+    {113, 169, 12}, {114, 169, 14}, {115, 169, 15}, {126, 169, 19}, {127, 169, 20}, {129, 169, 21}, {135, 169, 39}, {136, 169, 41},
+    {137, 169, 42}, {147, 169, 46}, {148, 169, 47}, {150, 169, 48}, {156, 169, 66}, {157, 169, 68}, {158, 169, 69}, {167, 169, 73},
+    {168, 169, 74}, {170, 169, 75}, {176, 169, 93}, {177, 169, 95}, {178, 169, 96}, {186, 169, 100}, {187, 169, 101}, {189, 169, 102},
+    {209, 169, 22}, {210, 169, 23}, {212, 169, 24}, {229, 169, 49}, {230, 169, 50}, {232, 169, 51}, {246, 169, 76}, {247, 169, 77},
+    {249, 169, 78}, {260, 169, 103}, {261, 169, 104}, {263, 169, 105}, {52, 170, 9}, {54, 170, 10}, {64, 170, 36}, {66, 170, 37},
+    {76, 170, 63}, {78, 170, 64}, {88, 170, 90}, {90, 170, 91}, {99, 170, 110}, {102, 170, 111}, {113, 170, 13}, {114, 170, 15},
+    {126, 170, 20}, {128, 170, 21}, {135, 170, 40}, {136, 170, 42}, {147, 170, 47}, {149, 170, 48}, {156, 170, 67}, {157, 170, 69},
+    {167, 170, 74}, {169, 170, 75}, {176, 170, 94}, {177, 170, 96}, {186, 170, 101}, {188, 170, 102}, {209, 170, 23}, {211, 170, 24},
+    {229, 170, 50}, {231, 170, 51}, {246, 170, 77}, {248, 170, 78}, {260, 170, 104}, {262, 170, 105}, {51, 171, 8}, {53, 171, 10},
+    {63, 171, 35}, {65, 171, 37}, {75, 171, 62}, {77, 171, 64}, {87, 171, 89}, {89, 171, 91}, {101, 171, 111}, {113, 171, 14},
+    {125, 171, 19}, {127, 171, 21}, {135, 171, 41}, {146, 171, 46}, {148, 171, 48}, {156, 171, 68}, {166, 171, 73}, {168, 171, 75},
+    {176, 171, 95}, {185, 171, 100}, {187, 171, 102}, {208, 171, 22}, {210, 171, 24}, {228, 171, 49}, {230, 171, 51}, {245, 171, 76},
+    {247, 171, 78}, {259, 171, 103}, {261, 171, 105}, {51, 172, 9}, {52, 172, 10}, {63, 172, 36}, {64, 172, 37}, {75, 172, 63},
+    {76, 172, 64}, {87, 172, 90}, {88, 172, 91}, {100, 172, 111}, {113, 172, 15}, {125, 172, 20}, {126, 172, 21}, {135, 172, 42},
+    {146, 172, 47}, {147, 172, 48}, {156, 172, 69}, {166, 172, 74}, {167, 172, 75}, {176, 172, 96}, {185, 172, 101}, {186, 172, 102},
+    {208, 172, 23}, {209, 172, 24}, {228, 172, 50}, {229, 172, 51}, {245, 172, 77}, {246, 172, 78}, {259, 172, 104}, {260, 172, 105},
+    {51, 173, 10}, {63, 173, 37}, {75, 173, 64}, {87, 173, 91}, {99, 173, 111}, {125, 173, 21}, {146, 173, 48}, {166, 173, 75},
+    {185, 173, 102}, {208, 173, 24}, {228, 173, 51}, {245, 173, 78}, {259, 173, 105}, {50, 174, 6}, {62, 174, 33}, {74, 174, 60},
+    {86, 174, 87}, {98, 174, 109}, {118, 174, 16}, {124, 174, 19}, {140, 174, 43}, {145, 174, 46}, {161, 174, 70}, {165, 174, 73},
+    {181, 174, 97}, {184, 174, 100}, {217, 174, 25}, {227, 174, 26}, {237, 174, 52}, {244, 174, 53}, {254, 174, 79}, {258, 174, 80},
+    {268, 174, 106}, {47, 175, 1}, {49, 175, 6}, {50, 175, 7}, {59, 175, 28}, {61, 175, 33}, {62, 175, 34}, {71, 175, 55},
+    {73, 175, 60}, {74, 175, 61}, {83, 175, 82}, {85, 175, 87}, {86, 175, 88}, {97, 175, 109}, {117, 175, 16}, {118, 175, 17},
+    {123, 175, 19}, {124, 175, 20}, {139, 175, 43}, {140, 175, 44}, {145, 175, 47}, {160, 175, 70}, {161, 175, 71}, {165, 175, 74},
+    {180, 175, 97}, {181, 175, 98}, {184, 175, 101}, {216, 175, 25}, {226, 175, 26}, {236, 175, 52}, {253, 175, 79}, {267, 175, 106},
+    {46, 176, 1}, {47, 176, 2}, {49, 176, 7}, {58, 176, 28}, {59, 176, 29}, {61, 176, 34}, {70, 176, 55}, {71, 176, 56},
+    {73, 176, 61}, {82, 176, 82}, {83, 176, 83}, {85, 176, 88}, {98, 176, 110}, {116, 176, 16}, {117, 176, 17}, {122, 176, 19},
+    {123, 176, 20}, {138, 176, 43}, {139, 176, 44}, {144, 176, 46}, {159, 176, 70}, {160, 176, 71}, {179, 176, 97}, {180, 176, 98},
+    {215, 176, 25}, {225, 176, 26}, {235, 176, 52}, {252, 176, 79}, {266, 176, 106}, {46, 177, 2}, {58, 177, 29}, {70, 177, 56},
+    {82, 177, 83}, {97, 177, 110}, {116, 177, 17}, {122, 177, 20}, {138, 177, 44}, {144, 177, 47}, {159, 177, 71}, {179, 177, 98},
+    {214, 177, 25}, {224, 177, 26}, {234, 177, 52}, {243, 177, 53}, {251, 177, 79}, {265, 177, 106}, {47, 178, 3}, {48, 178, 6},
+    {50, 178, 8}, {59, 178, 30}, {60, 178, 33}, {62, 178, 35}, {71, 178, 57}, {72, 178, 60}, {74, 178, 62}, {83, 178, 84},
+    {84, 178, 87}, {86, 178, 89}, {96, 178, 109}, {115, 178, 16}, {118, 178, 18}, {121, 178, 19}, {124, 178, 21}, {137, 178, 43},
+    {140, 178, 45}, {143, 178, 46}, {145, 178, 48}, {158, 178, 70}, {161, 178, 72}, {164, 178, 73}, {165, 178, 75}, {178, 178, 97},
+    {181, 178, 99}, {184, 178, 102}, {213, 178, 25}, {223, 178, 26}, {233, 178, 52}, {242, 178, 53}, {250, 178, 79}, {264, 178, 106},
+    {45, 179, 1}, {46, 179, 3}, {47, 179, 4}, {48, 179, 7}, {49, 179, 8}, {50, 179, 9}, {57, 179, 28}, {58, 179, 30},
+    {59, 179, 31}, {60, 179, 34}, {61, 179, 35}, {62, 179, 36}, {69, 179, 55}, {70, 179, 57}, {71, 179, 58}, {72, 179, 61},
+    {73, 179, 62}, {74, 179, 63}, {81, 179, 82}, {82, 179, 84}, {83, 179, 85}, {84, 179, 88}, {85, 179, 89}, {86, 179, 90},
+    {114, 179, 16}, {115, 179, 17}, {117, 179, 18}, {120, 179, 19}, {121, 179, 20}, {123, 179, 21}, {136, 179, 43}, {137, 179, 44},
+    {139, 179, 45}, {142, 179, 46}, {143, 179, 47}, {157, 179, 70}, {158, 179, 71}, {160, 179, 72}, {163, 179, 73}, {164, 179, 74},
+    {177, 179, 97}, {178, 179, 98}, {180, 179, 99}, {183, 179, 100}, {212, 179, 25}, {222, 179, 26}, {232, 179, 52}, {249, 179, 79},
+    {263, 179, 106}, {45, 180, 2}, {46, 180, 4}, {49, 180, 9}, {57, 180, 29}, {58, 180, 31}, {61, 180, 36}, {69, 180, 56},
+    {70, 180, 58}, {73, 180, 63}, {81, 180, 83}, {82, 180, 85}, {85, 180, 90}, {96, 180, 110}, {114, 180, 17}, {116, 180, 18},
+    {120, 180, 20}, {122, 180, 21}, {136, 180, 44}, {138, 180, 45}, {142, 180, 47}, {144, 180, 48}, {157, 180, 71}, {159, 180, 72},
+    {163, 180, 74}, {177, 180, 98}, {179, 180, 99}, {183, 180, 101}, {211, 180, 25}, {221, 180, 26}, {231, 180, 52}, {241, 180, 53},
+    {248, 180, 79}, {262, 180, 106}, {45, 181, 3}, {47, 181, 5}, {48, 181, 8}, {50, 181, 10}, {57, 181, 30}, {59, 181, 32},
+    {60, 181, 35}, {62, 181, 37}, {69, 181, 57}, {71, 181, 59}, {72, 181, 62}, {74, 181, 64}, {81, 181, 84}, {83, 181, 86},
+    {84, 181, 89}, {86, 181, 91}, {98, 181, 111}, {113, 181, 16}, {115, 181, 18}, {119, 181, 19}, {121, 181, 21}, {135, 181, 43},
+    {137, 181, 45}, {141, 181, 46}, {143, 181, 48}, {156, 181, 70}, {158, 181, 72}, {162, 181, 73}, {164, 181, 75}, {176, 181, 97},
+    {178, 181, 99}, {182, 181, 100}, {210, 181, 25}, {220, 181, 26}, {230, 181, 52}, {240, 181, 53}, {247, 181, 79}, {257, 181, 80},
+    {261, 181, 106}, {45, 182, 4}, {46, 182, 5}, {48, 182, 9}, {49, 182, 10}, {57, 182, 31}, {58, 182, 32}, {60, 182, 36},
+    {61, 182, 37}, {69, 182, 58}, {70, 182, 59}, {72, 182, 63}, {73, 182, 64}, {81, 182, 85}, {82, 182, 86}, {84, 182, 90},
+    {85, 182, 91}, {97, 182, 111}, {113, 182, 17}, {114, 182, 18}, {119, 182, 20}, {120, 182, 21}, {135, 182, 44}, {136, 182, 45},
+    {141, 182, 47}, {142, 182, 48}, {156, 182, 71}, {157, 182, 72}, {162, 182, 74}, {163, 182, 75}, {176, 182, 98}, {177, 182, 99},
+    {182, 182, 101}, {183, 182, 102}, {209, 182, 25}, {219, 182, 26}, {229, 182, 52}, {239, 182, 53}, {246, 182, 79}, {256, 182, 80},
+    {260, 182, 106}, {45, 183, 5}, {48, 183, 10}, {57, 183, 32}, {60, 183, 37}, {69, 183, 59}, {72, 183, 64}, {81, 183, 86},
+    {84, 183, 91}, {96, 183, 111}, {113, 183, 18}, {119, 183, 21}, {135, 183, 45}, {141, 183, 48}, {156, 183, 72}, {162, 183, 75},
+    {176, 183, 99}, {182, 183, 102}, {208, 183, 25}, {218, 183, 26}, {228, 183, 52}, {238, 183, 53}, {245, 183, 79}, {255, 183, 80},
+    {259, 183, 106}, {47, 184, 6}, {59, 184, 33}, {71, 184, 60}, {83, 184, 87}, {95, 184, 109}, {118, 184, 19}, {140, 184, 46},
+    {161, 184, 73}, {181, 184, 100}, {217, 184, 26}, {237, 184, 53}, {254, 184, 80}, {268, 184, 107}, {46, 185, 6}, {47, 185, 7},
+    {58, 185, 33}, {59, 185, 34}, {70, 185, 60}, {71, 185, 61}, {82, 185, 87}, {83, 185, 88}, {94, 185, 109}, {117, 185, 19},
+    {118, 185, 20}, {139, 185, 46}, {140, 185, 47}, {160, 185, 73}, {161, 185, 74}, {180, 185, 100}, {181, 185, 101}, {216, 185, 26},
+    {236, 185, 53}, {253, 185, 80}, {267, 185, 107}, {46, 186, 7}, {58, 186, 34}, {70, 186, 61}, {82, 186, 88}, {95, 186, 110},
+    {116, 186, 19}, {117, 186, 20}, {138, 186, 46}, {139, 186, 47}, {159, 186, 73}, {160, 186, 74}, {179, 186, 100}, {180, 186, 101},
+    {215, 186, 26}, {235, 186, 53}, {252, 186, 80}, {266, 186, 107}, {94, 187, 110}, {116, 187, 20}, {138, 187, 47}, {159, 187, 74},
+    {179, 187, 101}, {214, 187, 26}, {234, 187, 53}, {251, 187, 80}, {265, 187, 107}, {45, 188, 6}, {47, 188, 8}, {57, 188, 33},
+    {59, 188, 35}, {69, 188, 60}, {71, 188, 62}, {81, 188, 87}, {83, 188, 89}, {93, 188, 109}, {115, 188, 19}, {118, 188, 21},
+    {137, 188, 46}, {140, 188, 48}, {158, 188, 73}, {161, 188, 75}, {178, 188, 100}, {181, 188, 102}, {213, 188, 26}, {233, 188, 53},
+    {250, 188, 80}, {264, 188, 107}, {45, 189, 7}, {46, 189, 8}, {47, 189, 9}, {57, 189, 34}, {58, 189, 35}, {59, 189, 36},
+    {69, 189, 61}, {70, 189, 62}, {71, 189, 63}, {81, 189, 88}, {82, 189, 89}, {83, 189, 90}, {114, 189, 19}, {115, 189, 20},
+    {117, 189, 21}, {136, 189, 46}, {137, 189, 47}, {139, 189, 48}, {157, 189, 73}, {158, 189, 74}, {160, 189, 75}, {177, 189, 100},
+    {178, 189, 101}, {180, 189, 102}, {212, 189, 26}, {232, 189, 53}, {249, 189, 80}, {263, 189, 107}, {46, 190, 9}, {58, 190, 36},
+    {70, 190, 63}, {82, 190, 90}, {93, 190, 110}, {114, 190, 20}, {116, 190, 21}, {136, 190, 47}, {138, 190, 48}, {157, 190, 74},
+    {159, 190, 75}, {177, 190, 101}, {179, 190, 102}, {211, 190, 26}, {231, 190, 53}, {248, 190, 80}, {262, 190, 107}, {45, 191, 8},
+    {47, 191, 10}, {57, 191, 35}, {59, 191, 37}, {69, 191, 62}, {71, 191, 64}, {81, 191, 89}, {83, 191, 91}, {95, 191, 111},
+    {113, 191, 19}, {115, 191, 21}, {135, 191, 46}, {137, 191, 48}, {156, 191, 73}, {158, 191, 75}, {176, 191, 100}, {178, 191, 102},
+    {210, 191, 26}, {230, 191, 53}, {247, 191, 80}, {261, 191, 107}, {45, 192, 9}, {46, 192, 10}, {57, 192, 36}, {58, 192, 37},
+    {69, 192, 63}, {70, 192, 64}, {81, 192, 90}, {82, 192, 91}, {94, 192, 111}, {113, 192, 20}, {114, 192, 21}, {135, 192, 47},
+    {136, 192, 48}, {156, 192, 74}, {157, 192, 75}, {176, 192, 101}, {177, 192, 102}, {209, 192, 26}, {229, 192, 53}, {246, 192, 80},
+    {260, 192, 107}, {45, 193, 10}, {57, 193, 37}, {69, 193, 64}, {81, 193, 91}, {93, 193, 111}, {113, 193, 21}, {135, 193, 48},
+    {156, 193, 75}, {176, 193, 102}, {208, 193, 26}, {228, 193, 53}, {245, 193, 80}, {259, 193, 107}, {269, 193, 112}, {44, 194, 109},
+    {56, 194, 11}, {68, 194, 38}, {80, 194, 65}, {92, 194, 92}, {134, 194, 22}, {155, 194, 49}, {175, 194, 76}, {194, 194, 103},
+    {43, 195, 109}, {55, 195, 11}, {56, 195, 12}, {67, 195, 38}, {68, 195, 39}, {79, 195, 65}, {80, 195, 66}, {91, 195, 92},
+    {92, 195, 93}, {133, 195, 22}, {134, 195, 23}, {154, 195, 49}, {155, 195, 50}, {174, 195, 76}, {175, 195, 77}, {193, 195, 103},
+    {194, 195, 104}, {42, 196, 109}, {44, 196, 110}, {54, 196, 11}, {55, 196, 12}, {56, 196, 13}, {66, 196, 38}, {67, 196, 39},
+    {68, 196, 40}, {78, 196, 65}, {79, 196, 66}, {80, 196, 67}, {90, 196, 92}, {91, 196, 93}, {92, 196, 94}, {132, 196, 22},
+    {133, 196, 23}, {153, 196, 49}, {154, 196, 50}, {173, 196, 76}, {174, 196, 77}, {192, 196, 103}, {193, 196, 104}, {41, 197, 109},
+    {53, 197, 11}, {56, 197, 14}, {65, 197, 38}, {68, 197, 41}, {77, 197, 65}, {80, 197, 68}, {89, 197, 92}, {92, 197, 95},
+    {130, 197, 22}, {134, 197, 24}, {151, 197, 49}, {155, 197, 51}, {171, 197, 76}, {175, 197, 78}, {190, 197, 103}, {194, 197, 105},
+    {40, 198, 109}, {52, 198, 11}, {53, 198, 12}, {55, 198, 14}, {56, 198, 15}, {64, 198, 38}, {65, 198, 39}, {67, 198, 41},
+    {68, 198, 42}, {76, 198, 65}, {77, 198, 66}, {79, 198, 68}, {80, 198, 69}, {88, 198, 92}, {89, 198, 93}, {91, 198, 95},
+    {92, 198, 96}, {129, 198, 22}, {130, 198, 23}, {133, 198, 24}, {150, 198, 49}, {151, 198, 50}, {154, 198, 51}, {170, 198, 76},
+    {171, 198, 77}, {174, 198, 78}, {189, 198, 103}, {190, 198, 104}, {193, 198, 105}, {39, 199, 109}, {44, 199, 111}, {51, 199, 11},
+    {53, 199, 14}, {63, 199, 38}, {65, 199, 41}, {75, 199, 65}, {77, 199, 68}, {87, 199, 92}, {89, 199, 95}, {127, 199, 22},
+    {130, 199, 24}, {148, 199, 49}, {151, 199, 51}, {168, 199, 76}, {171, 199, 78}, {187, 199, 103}, {190, 199, 105}, {38, 200, 109},
+    {50, 200, 11}, {56, 200, 16}, {62, 200, 38}, {68, 200, 43}, {74, 200, 65}, {80, 200, 70}, {86, 200, 92}, {92, 200, 97},
+    {124, 200, 22}, {134, 200, 25}, {145, 200, 49}, {155, 200, 52}, {165, 200, 76}, {175, 200, 79}, {184, 200, 103}, {194, 200, 106},
+    {227, 200, 27}, {244, 200, 54}, {258, 200, 81}, {14, 201, 1}, {19, 201, 28}, {24, 201, 55}, {29, 201, 82}, {37, 201, 109},
+    {49, 201, 11}, {50, 201, 12}, {55, 201, 16}, {56, 201, 17}, {61, 201, 38}, {62, 201, 39}, {67, 201, 43}, {68, 201, 44},
+    {73, 201, 65}, {74, 201, 66}, {79, 201, 70}, {80, 201, 71}, {85, 201, 92}, {86, 201, 93}, {91, 201, 97}, {92, 201, 98},
+    {123, 201, 22}, {124, 201, 23}, {133, 201, 25}, {145, 201, 50}, {154, 201, 52}, {165, 201, 77}, {174, 201, 79}, {184, 201, 104},
+    {193, 201, 106}, {226, 201, 27}, {13, 202, 1}, {14, 202, 2}, {18, 202, 28}, {19, 202, 29}, {23, 202, 55}, {24, 202, 56},
+    {28, 202, 82}, {29, 202, 83}, {38, 202, 110}, {49, 202, 12}, {50, 202, 13}, {54, 202, 16}, {55, 202, 17}, {61, 202, 39},
+    {62, 202, 40}, {66, 202, 43}, {67, 202, 44}, {73, 202, 66}, {74, 202, 67}, {78, 202, 70}, {79, 202, 71}, {85, 202, 93},
+    {86, 202, 94}, {90, 202, 97}, {91, 202, 98}, {122, 202, 22}, {123, 202, 23}, {132, 202, 25}, {144, 202, 49}, {153, 202, 52},
+    {173, 202, 79}, {192, 202, 106}, {225, 202, 27}, {13, 203, 2}, {18, 203, 29}, {23, 203, 56}, {28, 203, 83}, {37, 203, 110},
+    {49, 203, 13}, {54, 203, 17}, {61, 203, 40}, {66, 203, 44}, {73, 203, 67}, {78, 203, 71}, {85, 203, 94}, {90, 203, 98},
+    {122, 203, 23}, {131, 203, 25}, {144, 203, 50}, {152, 203, 52}, {172, 203, 79}, {191, 203, 106}, {224, 203, 27}, {243, 203, 54},
+    {14, 204, 3}, {19, 204, 30}, {24, 204, 57}, {29, 204, 84}, {36, 204, 109}, {48, 204, 11}, {50, 204, 14}, {53, 204, 16},
+    {56, 204, 18}, {60, 204, 38}, {62, 204, 41}, {65, 204, 43}, {68, 204, 45}, {72, 204, 65}, {74, 204, 68}, {77, 204, 70},
+    {80, 204, 72}, {84, 204, 92}, {86, 204, 95}, {89, 204, 97}, {92, 204, 99}, {121, 204, 22}, {124, 204, 24}, {130, 204, 25},
+    {143, 204, 49}, {145, 204, 51}, {151, 204, 52}, {164, 204, 76}, {165, 204, 78}, {171, 204, 79}, {184, 204, 105}, {190, 204, 106},
+    {223, 204, 27}, {242, 204, 54}, {12, 205, 1}, {13, 205, 3}, {14, 205, 4}, {17, 205, 28}, {18, 205, 30}, {19, 205, 31},
+    {22, 205, 55}, {23, 205, 57}, {24, 205, 58}, {27, 205, 82}, {28, 205, 84}, {29, 205, 85}, {48, 205, 12}, {49, 205, 14},
+    {50, 205, 15}, {52, 205, 16}, {53, 205, 17}, {55, 205, 18}, {60, 205, 39}, {61, 205, 41}, {62, 205, 42}, {64, 205, 43},
+    {65, 205, 44}, {67, 205, 45}, {72, 205, 66}, {73, 205, 68}, {74, 205, 69}, {76, 205, 70}, {77, 205, 71}, {79, 205, 72},
+    {84, 205, 93}, {85, 205, 95}, {86, 205, 96}, {88, 205, 97}, {89, 205, 98}, {91, 205, 99}, {120, 205, 22}, {121, 205, 23},
+    {123, 205, 24}, {129, 205, 25}, {142, 205, 49}, {143, 205, 50}, {150, 205, 52}, {163, 205, 76}, {164, 205, 77}, {170, 205, 79},
+    {183, 205, 103}, {189, 205, 106}, {222, 205, 27}, {12, 206, 2}, {13, 206, 4}, {17, 206, 29}, {18, 206, 31}, {22, 206, 56},
+    {23, 206, 58}, {27, 206, 83}, {28, 206, 85}, {36, 206, 110}, {48, 206, 13}, {49, 206, 15}, {52, 206, 17}, {54, 206, 18},
+    {60, 206, 40}, {61, 206, 42}, {64, 206, 44}, {66, 206, 45}, {72, 206, 67}, {73, 206, 69}, {76, 206, 71}, {78, 206, 72},
+    {84, 206, 94}, {85, 206, 96}, {88, 206, 98}, {90, 206, 99}, {120, 206, 23}, {122, 206, 24}, {128, 206, 25}, {142, 206, 50},
+    {144, 206, 51}, {149, 206, 52}, {163, 206, 77}, {169, 206, 79}, {183, 206, 104}, {188, 206, 106}, {221, 206, 27}, {241, 206, 54},
+    {12, 207, 3}, {14, 207, 5}, {17, 207, 30}, {19, 207, 32}, {22, 207, 57}, {24, 207, 59}, {27, 207, 84}, {29, 207, 86},
+    {38, 207, 111}, {48, 207, 14}, {51, 207, 16}, {53, 207, 18}, {60, 207, 41}, {63, 207, 43}, {65, 207, 45}, {72, 207, 68},
+    {75, 207, 70}, {77, 207, 72}, {84, 207, 95}, {87, 207, 97}, {89, 207, 99}, {119, 207, 22}, {121, 207, 24}, {127, 207, 25},
+    {141, 207, 49}, {143, 207, 51}, {148, 207, 52}, {162, 207, 76}, {164, 207, 78}, {168, 207, 79}, {182, 207, 103}, {187, 207, 106},
+    {220, 207, 27}, {240, 207, 54}, {257, 207, 81}, {12, 208, 4}, {13, 208, 5}, {17, 208, 31}, {18, 208, 32}, {22, 208, 58},
+    {23, 208, 59}, {27, 208, 85}, {28, 208, 86}, {37, 208, 111}, {48, 208, 15}, {51, 208, 17}, {52, 208, 18}, {60, 208, 42},
+    {63, 208, 44}, {64, 208, 45}, {72, 208, 69}, {75, 208, 71}, {76, 208, 72}, {84, 208, 96}, {87, 208, 98}, {88, 208, 99},
+    {119, 208, 23}, {120, 208, 24}, {126, 208, 25}, {141, 208, 50}, {142, 208, 51}, {147, 208, 52}, {162, 208, 77}, {163, 208, 78},
+    {167, 208, 79}, {182, 208, 104}, {183, 208, 105}, {186, 208, 106}, {219, 208, 27}, {239, 208, 54}, {256, 208, 81}, {12, 209, 5},
+    {17, 209, 32}, {22, 209, 59}, {27, 209, 86}, {36, 209, 111}, {51, 209, 18}, {63, 209, 45}, {75, 209, 72}, {87, 209, 99},
+    {119, 209, 24}, {125, 209, 25}, {141, 209, 51}, {146, 209, 52}, {162, 209, 78}, {166, 209, 79}, {182, 209, 105}, {185, 209, 106},
+    {218, 209, 27}, {238, 209, 54}, {255, 209, 81}, {35, 210, 109}, {50, 210, 16}, {62, 210, 43}, {74, 210, 70}, {86, 210, 97},
+    {124, 210, 25}, {145, 210, 52}, {165, 210, 79}, {184, 210, 106}, {207, 210, 112}, {11, 211, 1}, {16, 211, 28}, {21, 211, 55},
+    {26, 211, 82}, {49, 211, 16}, {50, 211, 17}, {61, 211, 43}, {62, 211, 44}, {73, 211, 70}, {74, 211, 71}, {85, 211, 97},
+    {86, 211, 98}, {123, 211, 25}, {11, 212, 2}, {16, 212, 29}, {21, 212, 56}, {26, 212, 83}, {35, 212, 110}, {49, 212, 17},
+    {61, 212, 44}, {73, 212, 71}, {85, 212, 98}, {122, 212, 25}, {144, 212, 52}, {11, 213, 3}, {16, 213, 30}, {21, 213, 57},
+    {26, 213, 84}, {48, 213, 16}, {50, 213, 18}, {60, 213, 43}, {62, 213, 45}, {72, 213, 70}, {74, 213, 72}, {84, 213, 97},
+    {86, 213, 99}, {121, 213, 25}, {143, 213, 52}, {164, 213, 79}, {11, 214, 4}, {16, 214, 31}, {21, 214, 58}, {26, 214, 85},
+    {48, 214, 17}, {49, 214, 18}, {60, 214, 44}, {61, 214, 45}, {72, 214, 71}, {73, 214, 72}, {84, 214, 98}, {85, 214, 99},
+    {120, 214, 25}, {142, 214, 52}, {163, 214, 79}, {183, 214, 106}, {11, 215, 5}, {16, 215, 32}, {21, 215, 59}, {26, 215, 86},
+    {35, 215, 111}, {48, 215, 18}, {60, 215, 45}, {72, 215, 72}, {84, 215, 99}, {119, 215, 25}, {141, 215, 52}, {162, 215, 79},
+    {182, 215, 106}, {206, 215, 112}, {14, 216, 6}, {19, 216, 33}, {24, 216, 60}, {29, 216, 87}, {34, 216, 109}, {47, 216, 11},
+    {56, 216, 19}, {59, 216, 38}, {68, 216, 46}, {71, 216, 65}, {80, 216, 73}, {83, 216, 92}, {92, 216, 100}, {118, 216, 22},
+    {134, 216, 26}, {140, 216, 49}, {155, 216, 53}, {161, 216, 76}, {175, 216, 80}, {181, 216, 103}, {194, 216, 107}, {217, 216, 27},
+    {237, 216, 54}, {254, 216, 81}, {268, 216, 108}, {13, 217, 6}, {14, 217, 7}, {18, 217, 33}, {19, 217, 34}, {23, 217, 60},
+    {24, 217, 61}, {28, 217, 87}, {29, 217, 88}, {33, 217, 109}, {46, 217, 11}, {47, 217, 12}, {55, 217, 19}, {56, 217, 20},
+    {58, 217, 38}, {59, 217, 39}, {67, 217, 46}, {68, 217, 47}, {70, 217, 65}, {71, 217, 66}, {79, 217, 73}, {80, 217, 74},
+    {82, 217, 92}, {83, 217, 93}, {91, 217, 100}, {92, 217, 101}, {117, 217, 22}, {118, 217, 23}, {133, 217, 26}, {139, 217, 49},
+    {140, 217, 50}, {154, 217, 53}, {160, 217, 76}, {161, 217, 77}, {174, 217, 80}, {180, 217, 103}, {181, 217, 104}, {193, 217, 107},
+    {216, 217, 27}, {236, 217, 54}, {253, 217, 81}, {267, 217, 108}, {13, 218, 7}, {18, 218, 34}, {23, 218, 61}, {28, 218, 88},
+    {34, 218, 110}, {46, 218, 12}, {47, 218, 13}, {54, 218, 19}, {55, 218, 20}, {58, 218, 39}, {59, 218, 40}, {66, 218, 46},
+    {67, 218, 47}, {70, 218, 66}, {71, 218, 67}, {78, 218, 73}, {79, 218, 74}, {82, 218, 93}, {83, 218, 94}, {90, 218, 100},
+    {91, 218, 101}, {116, 218, 22}, {117, 218, 23}, {132, 218, 26}, {138, 218, 49}, {139, 218, 50}, {153, 218, 53}, {159, 218, 76},
+    {160, 218, 77}, {173, 218, 80}, {179, 218, 103}, {180, 218, 104}, {192, 218, 107}, {215, 218, 27}, {235, 218, 54}, {252, 218, 81},
+    {266, 218, 108}, {33, 219, 110}, {46, 219, 13}, {54, 219, 20}, {58, 219, 40}, {66, 219, 47}, {70, 219, 67}, {78, 219, 74},
+    {82, 219, 94}, {90, 219, 101}, {116, 219, 23}, {131, 219, 26}, {138, 219, 50}, {152, 219, 53}, {159, 219, 77}, {172, 219, 80},
+    {179, 219, 104}, {191, 219, 107}, {214, 219, 27}, {234, 219, 54}, {251, 219, 81}, {265, 219, 108}, {12, 220, 6}, {14, 220, 8},
+    {17, 220, 33}, {19, 220, 35}, {22, 220, 60}, {24, 220, 62}, {27, 220, 87}, {29, 220, 89}, {32, 220, 109}, {45, 220, 11},
+    {47, 220, 14}, {53, 220, 19}, {56, 220, 21}, {57, 220, 38}, {59, 220, 41}, {65, 220, 46}, {68, 220, 48}, {69, 220, 65},
+    {71, 220, 68}, {77, 220, 73}, {80, 220, 75}, {81, 220, 92}, {83, 220, 95}, {89, 220, 100}, {92, 220, 102}, {115, 220, 22},
+    {118, 220, 24}, {130, 220, 26}, {137, 220, 49}, {140, 220, 51}, {151, 220, 53}, {158, 220, 76}, {161, 220, 78}, {171, 220, 80},
+    {178, 220, 103}, {181, 220, 105}, {190, 220, 107}, {213, 220, 27}, {233, 220, 54}, {250, 220, 81}, {264, 220, 108}, {12, 221, 7},
+    {13, 221, 8}, {14, 221, 9}, {17, 221, 34}, {18, 221, 35}, {19, 221, 36}, {22, 221, 61}, {23, 221, 62}, {24, 221, 63},
+    {27, 221, 88}, {28, 221, 89}, {29, 221, 90}, {45, 221, 12}, {46, 221, 14}, {47, 221, 15}, {52, 221, 19}, {53, 221, 20},
+    {55, 221, 21}, {57, 221, 39}, {58, 221, 41}, {59, 221, 42}, {64, 221, 46}, {65, 221, 47}, {67, 221, 48}, {69, 221, 66},
+    {70, 221, 68}, {71, 221, 69}, {76, 221, 73}, {77, 221, 74}, {79, 221, 75}, {81, 221, 93}, {82, 221, 95}, {83, 221, 96},
+    {88, 221, 100}, {89, 221, 101}, {91, 221, 102}, {114, 221, 22}, {115, 221, 23}, {117, 221, 24}, {129, 221, 26}, {136, 221, 49},
+    {137, 221, 50}, {139, 221, 51}, {150, 221, 53}, {157, 221, 76}, {158, 221, 77}, {160, 221, 78}, {170, 221, 80}, {177, 221, 103},
+    {178, 221, 104}, {180, 221, 105}, {189, 221, 107}, {212, 221, 27}, {232, 221, 54}, {249, 221, 81}, {263, 221, 108}, {13, 222, 9},
+    {18, 222, 36}, {23, 222, 63}, {28, 222, 90}, {32, 222, 110}, {45, 222, 13}, {46, 222, 15}, {52, 222, 20}, {54, 222, 21},
+    {57, 222, 40}, {58, 222, 42}, {64, 222, 47}, {66, 222, 48}, {69, 222, 67}, {70, 222, 69}, {76, 222, 74}, {78, 222, 75},
+    {81, 222, 94}, {82, 222, 96}, {88, 222, 101}, {90, 222, 102}, {114, 222, 23}, {116, 222, 24}, {128, 222, 26}, {136, 222, 50},
+    {138, 222, 51}, {149, 222, 53}, {157, 222, 77}, {159, 222, 78}, {169, 222, 80}, {177, 222, 104}, {179, 222, 105}, {188, 222, 107},
+    {211, 222, 27}, {231, 222, 54}, {248, 222, 81}, {262, 222, 108}, {12, 223, 8}, {14, 223, 10}, {17, 223, 35}, {19, 223, 37},
+    {22, 223, 62}, {24, 223, 64}, {27, 223, 89}, {29, 223, 91}, {34, 223, 111}, {45, 223, 14}, {51, 223, 19}, {53, 223, 21},
+    {57, 223, 41}, {63, 223, 46}, {65, 223, 48}, {69, 223, 68}, {75, 223, 73}, {77, 223, 75}, {81, 223, 95}, {87, 223, 100},
+    {89, 223, 102}, {113, 223, 22}, {115, 223, 24}, {127, 223, 26}, {135, 223, 49}, {137, 223, 51}, {148, 223, 53}, {156, 223, 76},
+    {158, 223, 78}, {168, 223, 80}, {176, 223, 103}, {178, 223, 105}, {187, 223, 107}, {205, 223, 112}, {210, 223, 27}, {230, 223, 54},
+    {247, 223, 81}, {261, 223, 108}, {12, 224, 9}, {13, 224, 10}, {17, 224, 36}, {18, 224, 37}, {22, 224, 63}, {23, 224, 64},
+    {27, 224, 90}, {28, 224, 91}, {33, 224, 111}, {45, 224, 15}, {51, 224, 20}, {52, 224, 21}, {57, 224, 42}, {63, 224, 47},
+    {64, 224, 48}, {69, 224, 69}, {75, 224, 74}, {76, 224, 75}, {81, 224, 96}, {87, 224, 101}, {88, 224, 102}, {113, 224, 23},
+    {114, 224, 24}, {126, 224, 26}, {135, 224, 50}, {136, 224, 51}, {147, 224, 53}, {156, 224, 77}, {157, 224, 78}, {167, 224, 80},
+    {176, 224, 104}, {177, 224, 105}, {186, 224, 107}, {204, 224, 112}, {209, 224, 27}, {229, 224, 54}, {246, 224, 81}, {260, 224, 108},
+    {12, 225, 10}, {17, 225, 37}, {22, 225, 64}, {27, 225, 91}, {32, 225, 111}, {51, 225, 21}, {63, 225, 48}, {75, 225, 75},
+    {87, 225, 102}, {113, 225, 24}, {125, 225, 26}, {135, 225, 51}, {146, 225, 53}, {156, 225, 78}, {166, 225, 80}, {176, 225, 105},
+    {185, 225, 107}, {203, 225, 112}, {208, 225, 27}, {228, 225, 54}, {245, 225, 81}, {259, 225, 108}, {11, 226, 6}, {16, 226, 33},
+    {21, 226, 60}, {26, 226, 87}, {31, 226, 109}, {47, 226, 16}, {50, 226, 19}, {59, 226, 43}, {62, 226, 46}, {71, 226, 70},
+    {74, 226, 73}, {83, 226, 97}, {86, 226, 100}, {118, 226, 25}, {124, 226, 26}, {140, 226, 52}, {145, 226, 53}, {161, 226, 79},
+    {165, 226, 80}, {181, 226, 106}, {184, 226, 107}, {202, 226, 112}, {10, 227, 1}, {11, 227, 7}, {15, 227, 28}, {16, 227, 34},
+    {20, 227, 55}, {21, 227, 61}, {25, 227, 82}, {26, 227, 88}, {46, 227, 16}, {47, 227, 17}, {49, 227, 19}, {50, 227, 20},
+    {58, 227, 43}, {59, 227, 44}, {61, 227, 46}, {62, 227, 47}, {70, 227, 70}, {71, 227, 71}, {73, 227, 73}, {74, 227, 74},
+    {82, 227, 97}, {83, 227, 98}, {85, 227, 100}, {86, 227, 101}, {117, 227, 25}, {123, 227, 26}, {139, 227, 52}, {160, 227, 79},
+    {180, 227, 106}, {10, 228, 2}, {15, 228, 29}, {20, 228, 56}, {25, 228, 83}, {31, 228, 110}, {46, 228, 17}, {49, 228, 20},
+    {58, 228, 44}, {61, 228, 47}, {70, 228, 71}, {73, 228, 74}, {82, 228, 98}, {85, 228, 101}, {116, 228, 25}, {122, 228, 26},
+    {138, 228, 52}, {144, 228, 53}, {159, 228, 79}, {179, 228, 106}, {10, 229, 3}, {11, 229, 8}, {15, 229, 30}, {16, 229, 35},
+    {20, 229, 57}, {21, 229, 62}, {25, 229, 84}, {26, 229, 89}, {45, 229, 16}, {47, 229, 18}, {48, 229, 19}, {50, 229, 21},
+    {57, 229, 43}, {59, 229, 45}, {60, 229, 46}, {62, 229, 48}, {69, 229, 70}, {71, 229, 72}, {72, 229, 73}, {74, 229, 75},
+    {81, 229, 97}, {83, 229, 99}, {84, 229, 100}, {86, 229, 102}, {115, 229, 25}, {121, 229, 26}, {137, 229, 52}, {143, 229, 53},
+    {158, 229, 79}, {164, 229, 80}, {178, 229, 106}, {10, 230, 4}, {11, 230, 9}, {15, 230, 31}, {16, 230, 36}, {20, 230, 58},
+    {21, 230, 63}, {25, 230, 85}, {26, 230, 90}, {45, 230, 17}, {46, 230, 18}, {48, 230, 20}, {49, 230, 21}, {57, 230, 44},
+    {58, 230, 45}, {60, 230, 47}, {61, 230, 48}, {69, 230, 71}, {70, 230, 72}, {72, 230, 74}, {73, 230, 75}, {81, 230, 98},
+    {82, 230, 99}, {84, 230, 101}, {85, 230, 102}, {114, 230, 25}, {120, 230, 26}, {136, 230, 52}, {142, 230, 53}, {157, 230, 79},
+    {163, 230, 80}, {177, 230, 106}, {183, 230, 107}, {10, 231, 5}, {11, 231, 10}, {15, 231, 32}, {16, 231, 37}, {20, 231, 59},
+    {21, 231, 64}, {25, 231, 86}, {26, 231, 91}, {31, 231, 111}, {45, 231, 18}, {48, 231, 21}, {57, 231, 45}, {60, 231, 48},
+    {69, 231, 72}, {72, 231, 75}, {81, 231, 99}, {84, 231, 102}, {113, 231, 25}, {119, 231, 26}, {135, 231, 52}, {141, 231, 53},
+    {156, 231, 79}, {162, 231, 80}, {176, 231, 106}, {182, 231, 107}, {201, 231, 112}, {10, 232, 6}, {15, 232, 33}, {20, 232, 60},
+    {25, 232, 87}, {30, 232, 109}, {47, 232, 19}, {59, 232, 46}, {71, 232, 73}, {83, 232, 100}, {118, 232, 26}, {140, 232, 53},
+    {161, 232, 80}, {181, 232, 107}, {200, 232, 112}, {10, 233, 7}, {15, 233, 34}, {20, 233, 61}, {25, 233, 88}, {46, 233, 19},
+    {47, 233, 20}, {58, 233, 46}, {59, 233, 47}, {70, 233, 73}, {71, 233, 74}, {82, 233, 100}, {83, 233, 101}, {117, 233, 26},
+    {139, 233, 53}, {160, 233, 80}, {180, 233, 107}, {199, 233, 112}, {30, 234, 110}, {46, 234, 20}, {58, 234, 47}, {70, 234, 74},
+    {82, 234, 101}, {116, 234, 26}, {138, 234, 53}, {159, 234, 80}, {179, 234, 107}, {198, 234, 112}, {10, 235, 8}, {15, 235, 35},
+    {20, 235, 62}, {25, 235, 89}, {45, 235, 19}, {47, 235, 21}, {57, 235, 46}, {59, 235, 48}, {69, 235, 73}, {71, 235, 75},
+    {81, 235, 100}, {83, 235, 102}, {115, 235, 26}, {137, 235, 53}, {158, 235, 80}, {178, 235, 107}, {197, 235, 112}, {10, 236, 9},
+    {15, 236, 36}, {20, 236, 63}, {25, 236, 90}, {45, 236, 20}, {46, 236, 21}, {57, 236, 47}, {58, 236, 48}, {69, 236, 74},
+    {70, 236, 75}, {81, 236, 101}, {82, 236, 102}, {114, 236, 26}, {136, 236, 53}, {157, 236, 80}, {177, 236, 107}, {196, 236, 112},
+    {10, 237, 10}, {15, 237, 37}, {20, 237, 64}, {25, 237, 91}, {30, 237, 111}, {45, 237, 21}, {57, 237, 48}, {69, 237, 75},
+    {81, 237, 102}, {113, 237, 26}, {135, 237, 53}, {156, 237, 80}, {176, 237, 107}, {195, 237, 112}, {9, 238, 109}, {14, 238, 11},
+    {19, 238, 38}, {24, 238, 65}, {29, 238, 92}, {56, 238, 22}, {68, 238, 49}, {80, 238, 76}, {92, 238, 103}, {134, 238, 27},
+    {155, 238, 54}, {175, 238, 81}, {194, 238, 108}, {8, 239, 109}, {13, 239, 11}, {14, 239, 12}, {18, 239, 38}, {19, 239, 39},
+    {23, 239, 65}, {24, 239, 66}, {28, 239, 92}, {29, 239, 93}, {55, 239, 22}, {56, 239, 23}, {67, 239, 49}, {68, 239, 50},
+    {79, 239, 76}, {80, 239, 77}, {91, 239, 103}, {92, 239, 104}, {133, 239, 27}, {154, 239, 54}, {174, 239, 81}, {193, 239, 108},
+    {9, 240, 110}, {13, 240, 12}, {14, 240, 13}, {18, 240, 39}, {19, 240, 40}, {23, 240, 66}, {24, 240, 67}, {28, 240, 93},
+    {29, 240, 94}, {54, 240, 22}, {55, 240, 23}, {66, 240, 49}, {67, 240, 50}, {78, 240, 76}, {79, 240, 77}, {90, 240, 103},
+    {91, 240, 104}, {132, 240, 27}, {153, 240, 54}, {173, 240, 81}, {192, 240, 108}, {8, 241, 110}, {13, 241, 13}, {18, 241, 40},
+    {23, 241, 67}, {28, 241, 94}, {54, 241, 23}, {66, 241, 50}, {78, 241, 77}, {90, 241, 104}, {131, 241, 27}, {152, 241, 54},
+    {172, 241, 81}, {191, 241, 108}, {7, 242, 109}, {12, 242, 11}, {14, 242, 14}, {17, 242, 38}, {19, 242, 41}, {22, 242, 65},
+    {24, 242, 68}, {27, 242, 92}, {29, 242, 95}, {53, 242, 22}, {56, 242, 24}, {65, 242, 49}, {68, 242, 51}, {77, 242, 76},
+    {80, 242, 78}, {89, 242, 103}, {92, 242, 105}, {130, 242, 27}, {151, 242, 54}, {171, 242, 81}, {190, 242, 108}, {12, 243, 12},
+    {13, 243, 14}, {14, 243, 15}, {17, 243, 39}, {18, 243, 41}, {19, 243, 42}, {22, 243, 66}, {23, 243, 68}, {24, 243, 69},
+    {27, 243, 93}, {28, 243, 95}, {29, 243, 96}, {52, 243, 22}, {53, 243, 23}, {55, 243, 24}, {64, 243, 49}, {65, 243, 50},
+    {67, 243, 51}, {76, 243, 76}, {77, 243, 77}, {79, 243, 78}, {88, 243, 103}, {89, 243, 104}, {91, 243, 105}, {112, 243, 112},
+    {129, 243, 27}, {150, 243, 54}, {170, 243, 81}, {189, 243, 108}, {7, 244, 110}, {12, 244, 13}, {13, 244, 15}, {17, 244, 40},
+    {18, 244, 42}, {22, 244, 67}, {23, 244, 69}, {27, 244, 94}, {28, 244, 96}, {52, 244, 23}, {54, 244, 24}, {64, 244, 50},
+    {66, 244, 51}, {76, 244, 77}, {78, 244, 78}, {88, 244, 104}, {90, 244, 105}, {111, 244, 112}, {128, 244, 27}, {149, 244, 54},
+    {169, 244, 81}, {188, 244, 108}, {9, 245, 111}, {12, 245, 14}, {17, 245, 41}, {22, 245, 68}, {27, 245, 95}, {51, 245, 22},
+    {53, 245, 24}, {63, 245, 49}, {65, 245, 51}, {75, 245, 76}, {77, 245, 78}, {87, 245, 103}, {89, 245, 105}, {127, 245, 27},
+    {148, 245, 54}, {168, 245, 81}, {187, 245, 108}, {8, 246, 111}, {12, 246, 15}, {17, 246, 42}, {22, 246, 69}, {27, 246, 96},
+    {51, 246, 23}, {52, 246, 24}, {63, 246, 50}, {64, 246, 51}, {75, 246, 77}, {76, 246, 78}, {87, 246, 104}, {88, 246, 105},
+    {110, 246, 112}, {126, 246, 27}, {147, 246, 54}, {167, 246, 81}, {186, 246, 108}, {7, 247, 111}, {51, 247, 24}, {63, 247, 51},
+    {75, 247, 78}, {87, 247, 105}, {125, 247, 27}, {146, 247, 54}, {166, 247, 81}, {185, 247, 108}, {6, 248, 109}, {11, 248, 11},
+    {14, 248, 16}, {16, 248, 38}, {19, 248, 43}, {21, 248, 65}, {24, 248, 70}, {26, 248, 92}, {29, 248, 97}, {50, 248, 22},
+    {56, 248, 25}, {62, 248, 49}, {68, 248, 52}, {74, 248, 76}, {80, 248, 79}, {86, 248, 103}, {92, 248, 106}, {109, 248, 112},
+    {124, 248, 27}, {145, 248, 54}, {165, 248, 81}, {184, 248, 108}, {1, 249, 1}, {2, 249, 28}, {3, 249, 55}, {4, 249, 82},
+    {11, 249, 12}, {13, 249, 16}, {14, 249, 17}, {16, 249, 39}, {18, 249, 43}, {19, 249, 44}, {21, 249, 66}, {23, 249, 70},
+    {24, 249, 71}, {26, 249, 93}, {28, 249, 97}, {29, 249, 98}, {49, 249, 22}, {50, 249, 23}, {55, 249, 25}, {61, 249, 49},
+    {62, 249, 50}, {67, 249, 52}, {73, 249, 76}, {74, 249, 77}, {79, 249, 79}, {85, 249, 103}, {86, 249, 104}, {91, 249, 106},
+    {123, 249, 27}, {1, 250, 2}, {2, 250, 29}, {3, 250, 56}, {4, 250, 83}, {6, 250, 110}, {11, 250, 13}, {13, 250, 17},
+    {16, 250, 40}, {18, 250, 44}, {21, 250, 67}, {23, 250, 71}, {26, 250, 94}, {28, 250, 98}, {49, 250, 23}, {54, 250, 25},
+    {61, 250, 50}, {66, 250, 52}, {73, 250, 77}, {78, 250, 79}, {85, 250, 104}, {90, 250, 106}, {122, 250, 27}, {144, 250, 54},
+    {1, 251, 3}, {2, 251, 30}, {3, 251, 57}, {4, 251, 84}, {11, 251, 14}, {12, 251, 16}, {14, 251, 18}, {16, 251, 41},
+    {17, 251, 43}, {19, 251, 45}, {21, 251, 68}, {22, 251, 70}, {24, 251, 72}, {26, 251, 95}, {27, 251, 97}, {29, 251, 99},
+    {48, 251, 22}, {50, 251, 24}, {53, 251, 25}, {60, 251, 49}, {62, 251, 51}, {65, 251, 52}, {72, 251, 76}, {74, 251, 78},
+    {77, 251, 79}, {84, 251, 103}, {86, 251, 105}, {89, 251, 106}, {121, 251, 27}, {143, 251, 54}, {164, 251, 81}, {1, 252, 4},
+    {2, 252, 31}, {3, 252, 58}, {4, 252, 85}, {11, 252, 15}, {12, 252, 17}, {13, 252, 18}, {16, 252, 42}, {17, 252, 44},
+    {18, 252, 45}, {21, 252, 69}, {22, 252, 71}, {23, 252, 72}, {26, 252, 96}, {27, 252, 98}, {28, 252, 99}, {48, 252, 23},
+    {49, 252, 24}, {52, 252, 25}, {60, 252, 50}, {61, 252, 51}, {64, 252, 52}, {72, 252, 77}, {73, 252, 78}, {76, 252, 79},
+    {84, 252, 104}, {85, 252, 105}, {88, 252, 106}, {120, 252, 27}, {142, 252, 54}, {163, 252, 81}, {183, 252, 108}, {1, 253, 5},
+    {2, 253, 32}, {3, 253, 59}, {4, 253, 86}, {6, 253, 111}, {12, 253, 18}, {17, 253, 45}, {22, 253, 72}, {27, 253, 99},
+    {48, 253, 24}, {51, 253, 25}, {60, 253, 51}, {63, 253, 52}, {72, 253, 78}, {75, 253, 79}, {84, 253, 105}, {87, 253, 106},
+    {108, 253, 112}, {119, 253, 27}, {141, 253, 54}, {162, 253, 81}, {182, 253, 108}, {11, 254, 16}, {16, 254, 43}, {21, 254, 70},
+    {26, 254, 97}, {50, 254, 25}, {62, 254, 52}, {74, 254, 79}, {86, 254, 106}, {107, 254, 112}, {11, 255, 17}, {16, 255, 44},
+    {21, 255, 71}, {26, 255, 98}, {49, 255, 25}, {61, 255, 52}, {73, 255, 79}, {85, 255, 106}, {106, 255, 112}, {11, 256, 18},
+    {16, 256, 45}, {21, 256, 72}, {26, 256, 99}, {48, 256, 25}, {60, 256, 52}, {72, 256, 79}, {84, 256, 106}, {105, 256, 112},
+    {1, 257, 6}, {2, 257, 33}, {3, 257, 60}, {4, 257, 87}, {5, 257, 109}, {10, 257, 11}, {14, 257, 19}, {15, 257, 38},
+    {19, 257, 46}, {20, 257, 65}, {24, 257, 73}, {25, 257, 92}, {29, 257, 100}, {47, 257, 22}, {56, 257, 26}, {59, 257, 49},
+    {68, 257, 53}, {71, 257, 76}, {80, 257, 80}, {83, 257, 103}, {92, 257, 107}, {104, 257, 112}, {118, 257, 27}, {140, 257, 54},
+    {161, 257, 81}, {181, 257, 108}, {1, 258, 7}, {2, 258, 34}, {3, 258, 61}, {4, 258, 88}, {10, 258, 12}, {13, 258, 19},
+    {14, 258, 20}, {15, 258, 39}, {18, 258, 46}, {19, 258, 47}, {20, 258, 66}, {23, 258, 73}, {24, 258, 74}, {25, 258, 93},
+    {28, 258, 100}, {29, 258, 101}, {46, 258, 22}, {47, 258, 23}, {55, 258, 26}, {58, 258, 49}, {59, 258, 50}, {67, 258, 53},
+    {70, 258, 76}, {71, 258, 77}, {79, 258, 80}, {82, 258, 103}, {83, 258, 104}, {91, 258, 107}, {103, 258, 112}, {117, 258, 27},
+    {139, 258, 54}, {160, 258, 81}, {180, 258, 108}, {5, 259, 110}, {10, 259, 13}, {13, 259, 20}, {15, 259, 40}, {18, 259, 47},
+    {20, 259, 67}, {23, 259, 74}, {25, 259, 94}, {28, 259, 101}, {46, 259, 23}, {54, 259, 26}, {58, 259, 50}, {66, 259, 53},
+    {70, 259, 77}, {78, 259, 80}, {82, 259, 104}, {90, 259, 107}, {102, 259, 112}, {116, 259, 27}, {138, 259, 54}, {159, 259, 81},
+    {179, 259, 108}, {1, 260, 8}, {2, 260, 35}, {3, 260, 62}, {4, 260, 89}, {10, 260, 14}, {12, 260, 19}, {14, 260, 21},
+    {15, 260, 41}, {17, 260, 46}, {19, 260, 48}, {20, 260, 68}, {22, 260, 73}, {24, 260, 75}, {25, 260, 95}, {27, 260, 100},
+    {29, 260, 102}, {45, 260, 22}, {47, 260, 24}, {53, 260, 26}, {57, 260, 49}, {59, 260, 51}, {65, 260, 53}, {69, 260, 76},
+    {71, 260, 78}, {77, 260, 80}, {81, 260, 103}, {83, 260, 105}, {89, 260, 107}, {101, 260, 112}, {115, 260, 27}, {137, 260, 54},
+    {158, 260, 81}, {178, 260, 108}, {1, 261, 9}, {2, 261, 36}, {3, 261, 63}, {4, 261, 90}, {10, 261, 15}, {12, 261, 20},
+    {13, 261, 21}, {15, 261, 42}, {17, 261, 47}, {18, 261, 48}, {20, 261, 69}, {22, 261, 74}, {23, 261, 75}, {25, 261, 96},
+    {27, 261, 101}, {28, 261, 102}, {45, 261, 23}, {46, 261, 24}, {52, 261, 26}, {57, 261, 50}, {58, 261, 51}, {64, 261, 53},
+    {69, 261, 77}, {70, 261, 78}, {76, 261, 80}, {81, 261, 104}, {82, 261, 105}, {88, 261, 107}, {100, 261, 112}, {114, 261, 27},
+    {136, 261, 54}, {157, 261, 81}, {177, 261, 108}, {1, 262, 10}, {2, 262, 37}, {3, 262, 64}, {4, 262, 91}, {5, 262, 111},
+    {12, 262, 21}, {17, 262, 48}, {22, 262, 75}, {27, 262, 102}, {45, 262, 24}, {51, 262, 26}, {57, 262, 51}, {63, 262, 53},
+    {69, 262, 78}, {75, 262, 80}, {81, 262, 105}, {87, 262, 107}, {99, 262, 112}, {113, 262, 27}, {135, 262, 54}, {156, 262, 81},
+    {176, 262, 108}, {10, 263, 16}, {11, 263, 19}, {15, 263, 43}, {16, 263, 46}, {20, 263, 70}, {21, 263, 73}, {25, 263, 97},
+    {26, 263, 100}, {47, 263, 25}, {50, 263, 26}, {59, 263, 52}, {62, 263, 53}, {71, 263, 79}, {74, 263, 80}, {83, 263, 106},
+    {86, 263, 107}, {98, 263, 112}, {10, 264, 17}, {11, 264, 20}, {15, 264, 44}, {16, 264, 47}, {20, 264, 71}, {21, 264, 74},
+    {25, 264, 98}, {26, 264, 101}, {46, 264, 25}, {49, 264, 26}, {58, 264, 52}, {61, 264, 53}, {70, 264, 79}, {73, 264, 80},
+    {82, 264, 106}, {85, 264, 107}, {97, 264, 112}, {10, 265, 18}, {11, 265, 21}, {15, 265, 45}, {16, 265, 48}, {20, 265, 72},
+    {21, 265, 75}, {25, 265, 99}, {26, 265, 102}, {45, 265, 25}, {48, 265, 26}, {57, 265, 52}, {60, 265, 53}, {69, 265, 79},
+    {72, 265, 80}, {81, 265, 106}, {84, 265, 107}, {96, 265, 112}, {10, 266, 19}, {15, 266, 46}, {20, 266, 73}, {25, 266, 100},
+    {47, 266, 26}, {59, 266, 53}, {71, 266, 80}, {83, 266, 107}, {95, 266, 112}, {10, 267, 20}, {15, 267, 47}, {20, 267, 74},
+    {25, 267, 101}, {46, 267, 26}, {58, 267, 53}, {70, 267, 80}, {82, 267, 107}, {94, 267, 112}, {10, 268, 21}, {15, 268, 48},
+    {20, 268, 75}, {25, 268, 102}, {45, 268, 26}, {57, 268, 53}, {69, 268, 80}, {81, 268, 107}, {93, 268, 112}, {0, 269, 109},
+    {1, 269, 11}, {2, 269, 38}, {3, 269, 65}, {4, 269, 92}, {14, 269, 22}, {19, 269, 49}, {24, 269, 76}, {29, 269, 103},
+    {44, 269, 112}, {56, 269, 27}, {68, 269, 54}, {80, 269, 81}, {92, 269, 108}, {1, 270, 12}, {2, 270, 39}, {3, 270, 66},
+    {4, 270, 93}, {13, 270, 22}, {14, 270, 23}, {18, 270, 49}, {19, 270, 50}, {23, 270, 76}, {24, 270, 77}, {28, 270, 103},
+    {29, 270, 104}, {43, 270, 112}, {55, 270, 27}, {67, 270, 54}, {79, 270, 81}, {91, 270, 108}, {0, 271, 110}, {1, 271, 13},
+    {2, 271, 40}, {3, 271, 67}, {4, 271, 94}, {13, 271, 23}, {18, 271, 50}, {23, 271, 77}, {28, 271, 104}, {42, 271, 112},
+    {54, 271, 27}, {66, 271, 54}, {78, 271, 81}, {90, 271, 108}, {1, 272, 14}, {2, 272, 41}, {3, 272, 68}, {4, 272, 95},
+    {12, 272, 22}, {14, 272, 24}, {17, 272, 49}, {19, 272, 51}, {22, 272, 76}, {24, 272, 78}, {27, 272, 103}, {29, 272, 105},
+    {41, 272, 112}, {53, 272, 27}, {65, 272, 54}, {77, 272, 81}, {89, 272, 108}, {1, 273, 15}, {2, 273, 42}, {3, 273, 69},
+    {4, 273, 96}, {12, 273, 23}, {13, 273, 24}, {17, 273, 50}, {18, 273, 51}, {22, 273, 77}, {23, 273, 78}, {27, 273, 104},
+    {28, 273, 105}, {40, 273, 112}, {52, 273, 27}, {64, 273, 54}, {76, 273, 81}, {88, 273, 108}, {0, 274, 111}, {12, 274, 24},
+    {17, 274, 51}, {22, 274, 78}, {27, 274, 105}, {39, 274, 112}, {51, 274, 27}, {63, 274, 54}, {75, 274, 81}, {87, 274, 108},
+    {1, 275, 16}, {2, 275, 43}, {3, 275, 70}, {4, 275, 97}, {11, 275, 22}, {14, 275, 25}, {16, 275, 49}, {19, 275, 52},
+    {21, 275, 76}, {24, 275, 79}, {26, 275, 103}, {29, 275, 106}, {38, 275, 112}, {50, 275, 27}, {62, 275, 54}, {74, 275, 81},
+    {86, 275, 108}, {1, 276, 17}, {2, 276, 44}, {3, 276, 71}, {4, 276, 98}, {11, 276, 23}, {13, 276, 25}, {16, 276, 50},
+    {18, 276, 52}, {21, 276, 77}, {23, 276, 79}, {26, 276, 104}, {28, 276, 106}, {37, 276, 112}, {49, 276, 27}, {61, 276, 54},
+    {73, 276, 81}, {85, 276, 108}, {1, 277, 18}, {2, 277, 45}, {3, 277, 72}, {4, 277, 99}, {11, 277, 24}, {12, 277, 25},
+    {16, 277, 51}, {17, 277, 52}, {21, 277, 78}, {22, 277, 79}, {26, 277, 105}, {27, 277, 106}, {36, 277, 112}, {48, 277, 27},
+    {60, 277, 54}, {72, 277, 81}, {84, 277, 108}, {11, 278, 25}, {16, 278, 52}, {21, 278, 79}, {26, 278, 106}, {35, 278, 112},
+    {1, 279, 19}, {2, 279, 46}, {3, 279, 73}, {4, 279, 100}, {10, 279, 22}, {14, 279, 26}, {15, 279, 49}, {19, 279, 53},
+    {20, 279, 76}, {24, 279, 80}, {25, 279, 103}, {29, 279, 107}, {34, 279, 112}, {47, 279, 27}, {59, 279, 54}, {71, 279, 81},
+    {83, 279, 108}, {1, 280, 20}, {2, 280, 47}, {3, 280, 74}, {4, 280, 101}, {10, 280, 23}, {13, 280, 26}, {15, 280, 50},
+    {18, 280, 53}, {20, 280, 77}, {23, 280, 80}, {25, 280, 104}, {28, 280, 107}, {33, 280, 112}, {46, 280, 27}, {58, 280, 54},
+    {70, 280, 81}, {82, 280, 108}, {1, 281, 21}, {2, 281, 48}, {3, 281, 75}, {4, 281, 102}, {10, 281, 24}, {12, 281, 26},
+    {15, 281, 51}, {17, 281, 53}, {20, 281, 78}, {22, 281, 80}, {25, 281, 105}, {27, 281, 107}, {32, 281, 112}, {45, 281, 27},
+    {57, 281, 54}, {69, 281, 81}, {81, 281, 108}, {10, 282, 25}, {11, 282, 26}, {15, 282, 52}, {16, 282, 53}, {20, 282, 79},
+    {21, 282, 80}, {25, 282, 106}, {26, 282, 107}, {31, 282, 112}, {10, 283, 26}, {15, 283, 53}, {20, 283, 80}, {25, 283, 107},
+    {30, 283, 112}, {1, 284, 22}, {2, 284, 49}, {3, 284, 76}, {4, 284, 103}, {9, 284, 112}, {14, 284, 27}, {19, 284, 54},
+    {24, 284, 81}, {29, 284, 108}, {1, 285, 23}, {2, 285, 50}, {3, 285, 77}, {4, 285, 104}, {8, 285, 112}, {13, 285, 27},
+    {18, 285, 54}, {23, 285, 81}, {28, 285, 108}, {1, 286, 24}, {2, 286, 51}, {3, 286, 78}, {4, 286, 105}, {7, 286, 112},
+    {12, 286, 27}, {17, 286, 54}, {22, 286, 81}, {27, 286, 108}, {1, 287, 25}, {2, 287, 52}, {3, 287, 79}, {4, 287, 106},
+    {6, 287, 112}, {11, 287, 27}, {16, 287, 54}, {21, 287, 81}, {26, 287, 108}, {1, 288, 26}, {2, 288, 53}, {3, 288, 80},
+    {4, 288, 107}, {5, 288, 112}, {10, 288, 27}, {15, 288, 54}, {20, 288, 81}, {25, 288, 108}, {0, 289, 112}, {1, 289, 27},
+    {2, 289, 54}, {3, 289, 81}, {4, 289, 108}
+};
+
+#endif
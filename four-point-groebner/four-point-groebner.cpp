@@ -28,13 +28,17 @@
 #include <Eigen/Eigen>
 
 #include <Eigen/SparseQR>
-//#include <Eigen/SPQRSupport>
+#ifdef FOUR_POINT_GROEBNER_USE_SPQR
+#include <Eigen/SPQRSupport>
+#endif
 
 #include <opencv2/opencv.hpp>
 #include <opencv2/core/eigen.hpp>
 
 #include "precomp.hpp"
 #include "_modelest.h"
+#include "four-point-groebner.hpp"
+#include "four-point-groebner-template.hpp"
 
 /*
  * The coefficient matrix used in this Groebner basis solver 
@@ -47,13 +51,387 @@
 using namespace cv; 
 using namespace Eigen; 
 
-void four_point_groebner_helper(double p11, double p12, double p21, double p22, double p31, double p32, double p41, double p42,  
+void four_point_groebner_coeffs(double p11, double p12, double p21, double p22, double p31, double p32, double p41, double p42,  
                                 double q11, double q12, double q21, double q22, double q31, double q32, double q41, double q42, 
-                                double k1, double k3, SparseMatrix< double > & _M); 
+                                double k1, double k3, double c[113]); 
+
+/*
+ * The sparsity pattern of the elimination template is the same for 
+ * every sample, only the values of the 112 coefficients change. 
+ * The elimination therefore records once which coefficient goes to which 
+ * non-zero slot, and runs the fill-reducing ordering and the symbolic 
+ * analysis of the QR decomposition once. Each sample then only writes 
+ * the coefficients into the slots and does a numeric factorization. 
+ *
+ * The action matrix only needs 15 rows of B = MLeft^-1 * MRight. The 
+ * 255 columns of MLeft that are not needed are eliminated by QR, and 
+ * the same orthogonal transform is applied to the 15 needed columns 
+ * and to MRight. The last 15 rows of the result then form a 15x15 
+ * system that gives the needed rows of B directly, so the full sparse 
+ * back-substitution is never done. 
+ */
+template <typename Scalar>
+class FourPointGroebnerElimination
+{
+public:
+    FourPointGroebnerElimination(); 
+    // Returns an estimate of the reciprocal condition number of the elimination
+    Scalar actionMatrix(const double c[113], Matrix< Scalar , Dynamic, Dynamic> & A, int backend); 
+
+private: 
+    Scalar eliminateSparseQR(Matrix< Scalar , Dynamic, Dynamic> & B); 
+    Scalar eliminateSPQR(Matrix< Scalar , Dynamic, Dynamic> & B); 
+    Scalar eliminateDenseLU(Matrix< Scalar , Dynamic, Dynamic> & B); 
+
+    SparseMatrix< Scalar > MElim; 
+    Matrix< Scalar , Dynamic, Dynamic> MKeep; 
+    std::vector<int> elimCoeffs; 
+    std::vector<int> keepRows, keepCols, keepCoeffs; 
+    // MElim is not square, so COLAMD is used instead of AMD 
+    SparseQR<SparseMatrix< Scalar >, COLAMDOrdering<int> > analyzed; 
+
+    // Square matrix [MElim, first 15 columns of MKeep] for the dense backend
+    Matrix< Scalar , Dynamic, Dynamic> MDense; 
+    PartialPivLU<Matrix< Scalar , Dynamic, Dynamic> > denseLU; 
+}; 
+
+// Rows of B read by the action matrix, in the order of the rows of A, 
+// and the order of the basis monomials in the columns of A. 
+static const int amrows[15] = {269, 266, 263, 260, 258, 257, 254, 251, 249, 248, 245, 243, 242, 240, 239}; 
+static const int amcols[20] = {19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}; 
+
+template <typename Scalar>
+FourPointGroebnerElimination<Scalar>::FourPointGroebnerElimination()
+{
+    int rows = four_point_groebner_template_rows; 
+    int cols = four_point_groebner_template_cols; 
+    int nentries = sizeof(four_point_groebner_template) / sizeof(four_point_groebner_template[0]); 
+
+    // Column j of the template goes to column keep[j] of MKeep, 
+    // or to column elim[j] of MElim if keep[j] < 0. 
+    std::vector<int> keep(cols, -1), elim(cols, -1); 
+    for (int i = 0; i < 15; i++)
+        keep[amrows[i]] = i; 
+    for (int j = rows; j < cols; j++)
+        keep[j] = 15 + j - rows; 
+    for (int j = 0, jElim = 0; j < cols; j++)
+        if (keep[j] < 0) elim[j] = jElim++; 
+
+    // Use the coefficient indices as values, so that after compression 
+    // each non-zero of MElim tells which coefficient it takes. 
+    std::vector<Triplet< Scalar > > triplets; 
+    for (int i = 0; i < nentries; i++)
+    {
+        int r = four_point_groebner_template[i][0]; 
+        int j = four_point_groebner_template[i][1]; 
+        int k = four_point_groebner_template[i][2]; 
+        if (keep[j] < 0) 
+        {
+            triplets.push_back(Triplet< Scalar >(r, elim[j], k)); 
+        }
+        else
+        {
+            keepRows.push_back(r); 
+            keepCols.push_back(keep[j]); 
+            keepCoeffs.push_back(k); 
+        }
+    }
+
+    MElim.resize(rows, rows - 15); 
+    MElim.setFromTriplets(triplets.begin(), triplets.end()); 
+    elimCoeffs.resize(MElim.nonZeros()); 
+    for (int i = 0; i < MElim.nonZeros(); i++)
+        elimCoeffs[i] = (int)MElim.valuePtr()[i]; 
+
+    MKeep.resize(rows, 15 + cols - rows); 
+
+    analyzed.analyzePattern(MElim); 
+}
+
+template <typename Scalar>
+Scalar FourPointGroebnerElimination<Scalar>::actionMatrix(const double c[113], Matrix< Scalar , Dynamic, Dynamic> & A, int backend)
+{
+    Scalar * values = MElim.valuePtr(); 
+    for (size_t i = 0; i < elimCoeffs.size(); i++)
+        values[i] = c[elimCoeffs[i]]; 
+
+    MKeep.setZero(); 
+    for (size_t i = 0; i < keepCoeffs.size(); i++)
+        MKeep(keepRows[i], keepCols[i]) = c[keepCoeffs[i]]; 
+
+    // Rows of B needed by the action matrix, in the order of amrows
+    Matrix< Scalar , Dynamic, Dynamic> B; 
+    Scalar rcond; 
+    switch (backend)
+    {
+    case GROEBNER_SPQR:
+        rcond = eliminateSPQR(B); 
+        break; 
+    case GROEBNER_DENSE_LU:
+        rcond = eliminateDenseLU(B); 
+        break; 
+    default: 
+        rcond = eliminateSparseQR(B); 
+    }
+
+    A.resize(20, 20); 
+    A.setZero(); 
+    A(0, 5) = 1;
+	A(1, 10) = 1;
+	A(2, 14) = 1;
+	A(3, 17) = 1;
+	A(4, 19) = 1;
+    for (int i = 0; i < 20; i++)
+        for (int k = 0; k < 15; k++)
+            A(5 + k, i) = -B(k, amcols[i]); 
+
+    return rcond; 
+}
+
+// The ratio of the smallest to the largest pivot of a triangular 
+// factor is a cheap estimate of its reciprocal condition. 
+template <typename Scalar, typename Diagonal>
+static Scalar four_point_groebner_pivot_ratio(const Diagonal & diag)
+{
+    Scalar dmax = diag.cwiseAbs().maxCoeff(); 
+    if (dmax == 0) return 0; 
+    return diag.cwiseAbs().minCoeff() / dmax; 
+}
+
+template <typename Scalar>
+Scalar FourPointGroebnerElimination<Scalar>::eliminateSparseQR(Matrix< Scalar , Dynamic, Dynamic> & B)
+{
+    // SparseQR::factorize() can not be called twice on the same object, 
+    // so start every sample from a copy of the symbolic analysis. 
+    SparseQR<SparseMatrix< Scalar >, COLAMDOrdering<int> > qr(analyzed); 
+    qr.factorize(MElim); 
+    Matrix< Scalar , Dynamic, Dynamic> T(15, MKeep.cols()); 
+    for (int i = 0; i < MKeep.cols(); i++)
+    {
+        Matrix< Scalar , Dynamic, 1> t = qr.matrixQ().transpose() * MKeep.col(i); 
+        T.col(i) = t.tail(15); 
+    }
+
+    PartialPivLU<Matrix< Scalar , Dynamic, Dynamic> > lu(T.leftCols(15)); 
+    B = lu.solve(T.rightCols(T.cols() - 15)); 
+
+    if (qr.rank() < MElim.cols()) return 0; 
+    Matrix< Scalar , Dynamic, 1> rdiag(MElim.cols()); 
+    for (int i = 0; i < MElim.cols(); i++)
+        rdiag(i) = qr.matrixR().coeff(i, i); 
+    return std::min(four_point_groebner_pivot_ratio<Scalar>(rdiag), 
+                    four_point_groebner_pivot_ratio<Scalar>(lu.matrixLU().diagonal())); 
+}
+
+/*
+ * SuiteSparse only handles double, so the long double elimination 
+ * always goes through SparseQR. 
+ */
+template <typename Scalar>
+Scalar FourPointGroebnerElimination<Scalar>::eliminateSPQR(Matrix< Scalar , Dynamic, Dynamic> & B)
+{
+    return eliminateSparseQR(B); 
+}
+
+#ifdef FOUR_POINT_GROEBNER_USE_SPQR
+template <>
+double FourPointGroebnerElimination<double>::eliminateSPQR(Matrix< double , Dynamic, Dynamic> & B)
+{
+    SPQR<SparseMatrix< double > > spqr(MElim); 
+    if (spqr.info() != Success) return 0; 
+    Matrix< double , Dynamic, Dynamic> T(15, MKeep.cols()); 
+    for (int i = 0; i < MKeep.cols(); i++)
+    {
+        Matrix< double , Dynamic, 1> t = spqr.matrixQ().transpose() * MKeep.col(i); 
+        T.col(i) = t.tail(15); 
+    }
+
+    PartialPivLU<Matrix< double , Dynamic, Dynamic> > lu(T.leftCols(15)); 
+    B = lu.solve(T.rightCols(T.cols() - 15)); 
+
+    if (spqr.rank() < MElim.cols()) return 0; 
+    Matrix< double , Dynamic, 1> rdiag = spqr.matrixR().toDense().diagonal(); 
+    return std::min(four_point_groebner_pivot_ratio<double>(rdiag), 
+                    four_point_groebner_pivot_ratio<double>(lu.matrixLU().diagonal())); 
+}
+#endif
+
+/*
+ * The dense backend puts the 15 needed columns after the 255 eliminated 
+ * ones and does a plain LU of the 270x270 matrix. The last 15 rows of 
+ * the solution are the needed rows of B. The storage is reused between 
+ * samples, a fixed-size matrix this large would not fit on the stack. 
+ */
+template <typename Scalar>
+Scalar FourPointGroebnerElimination<Scalar>::eliminateDenseLU(Matrix< Scalar , Dynamic, Dynamic> & B)
+{
+    int nelim = MElim.cols(); 
+    MDense.resize(MElim.rows(), nelim + 15); 
+    MDense.leftCols(nelim).setZero(); 
+    for (int j = 0; j < nelim; j++)
+        for (typename SparseMatrix< Scalar >::InnerIterator it(MElim, j); it; ++it)
+            MDense(it.row(), j) = it.value(); 
+    MDense.rightCols(15) = MKeep.leftCols(15); 
+
+    denseLU.compute(MDense); 
+    Matrix< Scalar , Dynamic, Dynamic> X = denseLU.solve(MKeep.rightCols(MKeep.cols() - 15)); 
+    B = X.bottomRows(15); 
+
+    return four_point_groebner_pivot_ratio<Scalar>(denseLU.matrixLU().diagonal()); 
+}
+
+/*
+ * Only the real eigenvalues of the action matrix give real solutions. 
+ * Instead of computing all the complex eigenvectors of A, A is reduced 
+ * to real Schur form and the real eigenvalues are read off its diagonal. 
+ * A complex pair is kept as a real root when its imaginary part is below 
+ * imag_threshold. The eigenvector of each kept eigenvalue is recovered 
+ * by one step of inverse iteration. Returns the number of solutions, 
+ * each column of sols holds the 5 unknowns of one solution. cond is 
+ * the largest condition number |u| |v| / |u'v| of the exactly real 
+ * eigenvalues, where u and v are the left and right eigenvectors. 
+ */
+template <typename Scalar>
+static int four_point_groebner_real_solutions(const Matrix< Scalar , Dynamic, Dynamic> & A, Scalar imag_threshold, 
+                                              Matrix< Scalar , Dynamic, Dynamic> & sols, Scalar & cond)
+{
+    int n = A.rows(); 
+    cond = 0; 
+    RealSchur<Matrix< Scalar , Dynamic, Dynamic> > schur(A, false); 
+    if (schur.info() != Success) return 0; 
+    const Matrix< Scalar , Dynamic, Dynamic> & T = schur.matrixT(); 
+
+    std::vector<Scalar> lambdas; 
+    std::vector<bool> exact; 
+    for (int i = 0; i < n; )
+    {
+        if (i == n - 1 || T(i + 1, i) == 0)
+        {
+            lambdas.push_back(T(i, i)); 
+            exact.push_back(true); 
+            i++; 
+        }
+        else 
+        {
+            // 2x2 block of a complex conjugate pair
+            Scalar p = 0.5 * (T(i, i) - T(i + 1, i + 1)); 
+            Scalar z = p * p + T(i + 1, i) * T(i, i + 1); 
+            if (std::sqrt(std::abs(z)) < imag_threshold)
+            {
+                lambdas.push_back(T(i + 1, i + 1) + p); 
+                exact.push_back(false); 
+            }
+            i += 2; 
+        }
+    }
+
+    sols.resize(5, lambdas.size()); 
+    Matrix< Scalar , Dynamic, 1> ones = Matrix< Scalar , Dynamic, 1>::Ones(n); 
+    for (size_t k = 0; k < lambdas.size(); k++)
+    {
+        // Shift slightly off the eigenvalue to keep A - lambda * I invertible
+        Scalar shift = lambdas[k] + (1 + std::abs(lambdas[k])) * NumTraits<Scalar>::epsilon() * 1e4; 
+        Matrix< Scalar , Dynamic, Dynamic> S = A; 
+        S.diagonal().array() -= shift; 
+        Matrix< Scalar , Dynamic, 1> v = S.partialPivLu().solve(ones); 
+        sols.col(k) = v.segment(1, 5) / v(0); 
+
+        // A complex pair taken as real has no exact eigenvectors
+        if (!exact[k]) continue; 
+        Matrix< Scalar , Dynamic, Dynamic> St = S.transpose(); 
+        Matrix< Scalar , Dynamic, 1> u = St.partialPivLu().solve(ones); 
+        cond = std::max(cond, u.norm() * v.norm() / std::abs(u.dot(v))); 
+    }
+
+    return lambdas.size(); 
+}
+
+static int four_point_groebner_nsamples = 0; 
+static int four_point_groebner_nfallbacks = 0; 
+
+/*
+ * Solves the Groebner basis problem in double, and re-solves in long 
+ * double only the samples that look ill-conditioned: either the 
+ * elimination has a small reciprocal condition estimate, or a real 
+ * eigenvalue of the action matrix has a large condition number. 
+ * four_point_groebner_stats() reports how often the fallback is taken, 
+ * and four-point-groebner-benchmark prints it with the errors. 
+ */
+class FourPointGroebnerSolver
+{
+public:
+    FourPointGroebnerSolver(int _backend = GROEBNER_SPARSE_QR); 
+    ~FourPointGroebnerSolver(); 
+    int solve(const double c[113], Matrix< double , Dynamic, Dynamic> & sols); 
+
+private: 
+    FourPointGroebnerSolver(const FourPointGroebnerSolver &); 
+    FourPointGroebnerSolver & operator=(const FourPointGroebnerSolver &); 
+
+    int backend; 
+    FourPointGroebnerElimination< double > fast; 
+    // Only built when the first ill-conditioned sample shows up
+    FourPointGroebnerElimination< long double > * precise; 
+}; 
+
+FourPointGroebnerSolver::FourPointGroebnerSolver(int _backend)
+: backend( _backend ), precise( NULL ) 
+{
+    CV_Assert( backend == GROEBNER_SPARSE_QR || backend == GROEBNER_SPQR || backend == GROEBNER_DENSE_LU ); 
+#ifndef FOUR_POINT_GROEBNER_USE_SPQR
+    if (backend == GROEBNER_SPQR)
+        CV_Error( CV_StsNotImplemented, "Built without SPQR, reconfigure with FOUR_POINT_GROEBNER_USE_SPQR=ON" ); 
+#endif
+}
+
+FourPointGroebnerSolver::~FourPointGroebnerSolver()
+{
+    delete precise; 
+}
+
+int FourPointGroebnerSolver::solve(const double c[113], Matrix< double , Dynamic, Dynamic> & sols)
+{
+    const double imag_threshold = 0.1; 
+    const double min_rcond = 1e-10; 
+    const double max_cond = 1e4; 
+
+    CV_XADD(&four_point_groebner_nsamples, 1); 
+
+    Matrix< double , Dynamic, Dynamic> A; 
+    double rcond = fast.actionMatrix(c, A, backend); 
+    if (rcond >= min_rcond)
+    {
+        double cond; 
+        int count = four_point_groebner_real_solutions(A, imag_threshold, sols, cond); 
+        if (cond <= max_cond) return count; 
+    }
+
+    CV_XADD(&four_point_groebner_nfallbacks, 1); 
+    if (!precise) precise = new FourPointGroebnerElimination< long double >(); 
+
+    Matrix< long double , Dynamic, Dynamic> Ald, solsld; 
+    long double cond; 
+    precise->actionMatrix(c, Ald, GROEBNER_SPARSE_QR); 
+    int count = four_point_groebner_real_solutions(Ald, (long double)imag_threshold, solsld, cond); 
+    sols = solsld.cast< double >(); 
+    return count; 
+}
+
+void four_point_groebner_stats(int & nsamples, int & nfallbacks, bool reset)
+{
+    nsamples = four_point_groebner_nsamples; 
+    nfallbacks = four_point_groebner_nfallbacks; 
+    if (reset)
+    {
+        CV_XADD(&four_point_groebner_nsamples, -nsamples); 
+        CV_XADD(&four_point_groebner_nfallbacks, -nfallbacks); 
+    }
+}
 
 void four_point_groebner(cv::InputArray _points1, cv::InputArray _points2, 
                 double angle, double focal, cv::Point2d pp, 
-                cv::OutputArray _rvecs, cv::OutputArray _tvecs)
+                cv::OutputArray _rvecs, cv::OutputArray _tvecs, 
+                FourPointGroebnerSolver & solver)
 {
     Mat points1, points2; 
 	_points1.getMat().copyTo(points1); 
@@ -101,98 +479,32 @@ void four_point_groebner(cv::InputArray _points1, cv::InputArray _points2,
     k1 = cos(angle); 
     k3 = sin(angle); 
     
-    SparseMatrix< double > M; 
-
-    four_point_groebner_helper(p11, p12, p21, p22, p31, p32, p41, p42, 
-                               q11, q12, q21, q22, q31, q32, q41, q42, k1, k3, M); 
-    
-    // TODO: To switch to long double, replace all "_double_" to "long double". 
-
-    SparseMatrix< double > MLeft = M.innerVectors(0, M.rows()); 
-    Matrix< double , Dynamic, Dynamic> MRight = M.innerVectors(M.rows(), M.cols() - M.rows()); 
-
-
-/*    SPQR<SparseMatrix< double > > spqr(MLeft); 
-    Matrix< double , Dynamic, Dynamic> B(MRight.rows(), MRight.cols()); 
-    for (int i = 0; i < MRight.cols(); i++)
-    {
-        Matrix< double , Dynamic, 1> b = spqr.solve(MRight.col(i)); 
-        B.col(i) = b;         
-    }*/
-
-    SparseQR<SparseMatrix< double >, AMDOrdering<int> > qr(MLeft); 
-    Matrix< double , Dynamic, Dynamic> B(MRight.rows(), MRight.cols()); 
-    for (int i = 0; i < MRight.cols(); i++)
-    {
-        Matrix< double , Dynamic, 1> b = qr.solve(MRight.col(i)); 
-        B.col(i) = b;         
-    }
-
-    int amcols[20] = {19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0}; 
-    Matrix< double , Dynamic, Dynamic> A(20, 20); 
-    A.setZero(); 
-    A(0, 5) = 1;
-	A(1, 10) = 1;
-	A(2, 14) = 1;
-	A(3, 17) = 1;
-	A(4, 19) = 1;
-    for (int i = 0; i < 20; i++)
-    {
-    	A(5, i) = -B(269, amcols[i]);
-    	A(6, i) = -B(266, amcols[i]);
-    	A(7, i) = -B(263, amcols[i]);
-    	A(8, i) = -B(260, amcols[i]);
-    	A(9, i) = -B(258, amcols[i]);
-    	A(10, i) = -B(257, amcols[i]);
-    	A(11, i) = -B(254, amcols[i]);
-    	A(12, i) = -B(251, amcols[i]);
-    	A(13, i) = -B(249, amcols[i]);
-    	A(14, i) = -B(248, amcols[i]);
-    	A(15, i) = -B(245, amcols[i]);
-    	A(16, i) = -B(243, amcols[i]);
-    	A(17, i) = -B(242, amcols[i]);
-    	A(18, i) = -B(240, amcols[i]);
-    	A(19, i) = -B(239, amcols[i]);
-    }
-
-	EigenSolver<Eigen::Matrix< double , Dynamic, Dynamic> > eig(A); 
-
-	Matrix<std::complex< double >, Dynamic, Dynamic> Vcld; 
-	Vcld = eig.eigenvectors(); 
-
-    MatrixXcd Vc, sols; 
-    Vc = Vcld.cast<std::complex<double> >(); 
-	sols = Vc.block<5, 20>(1, 0).array() / (Eigen::MatrixXd::Ones(5, 1) * Vc.row(0)).array(); 
-    
-    double imag_threshold = 0.1; 
+    double c[113]; 
+    four_point_groebner_coeffs(p11, p12, p21, p22, p31, p32, p41, p42, 
+                               q11, q12, q21, q22, q31, q32, q41, q42, k1, k3, c); 
 
-    int count = 0; 
-    for (int i = 0; i < sols.cols(); i++)
-    {
-        if (fabs(sols(0, i).imag()) < imag_threshold) count++;         
-    }
+    Matrix< double , Dynamic, Dynamic> sols; 
+    int count = solver.solve(c, sols); 
     
     _rvecs.create(3, count * 2, CV_64F, -1, true); 
     _tvecs.create(3, count * 2, CV_64F, -1, true); 
    
-    for (int i = 0, j = 0; i < sols.cols(); i++)
+    for (int i = 0, j = 0; i < count; i++)
     {
-        if (fabs(sols(0, i).imag()) >= imag_threshold) continue; 
-
-        Mat tvec = (Mat_<double>(3, 1) << sols(1, i).real(), sols(0, i).real(), 1); 
+        Mat tvec = (Mat_<double>(3, 1) << sols(1, i), sols(0, i), 1); 
         normalize(tvec, tvec); 
 
-        _rvecs.getMat().at<double>(0, j) = sols(4, i).real(); 
-        _rvecs.getMat().at<double>(1, j) = sols(3, i).real(); 
-        _rvecs.getMat().at<double>(2, j) = sols(2, i).real(); 
+        _rvecs.getMat().at<double>(0, j) = sols(4, i); 
+        _rvecs.getMat().at<double>(1, j) = sols(3, i); 
+        _rvecs.getMat().at<double>(2, j) = sols(2, i); 
         _tvecs.getMat().at<double>(0, j) = tvec.at<double>(0); 
         _tvecs.getMat().at<double>(1, j) = tvec.at<double>(1); 
         _tvecs.getMat().at<double>(2, j) = tvec.at<double>(2); 
         j++; 
 
-        _rvecs.getMat().at<double>(0, j) = sols(4, i).real(); 
-        _rvecs.getMat().at<double>(1, j) = sols(3, i).real(); 
-        _rvecs.getMat().at<double>(2, j) = sols(2, i).real(); 
+        _rvecs.getMat().at<double>(0, j) = sols(4, i); 
+        _rvecs.getMat().at<double>(1, j) = sols(3, i); 
+        _rvecs.getMat().at<double>(2, j) = sols(2, i); 
         _tvecs.getMat().at<double>(0, j) = -tvec.at<double>(0); 
         _tvecs.getMat().at<double>(1, j) = -tvec.at<double>(1); 
         _tvecs.getMat().at<double>(2, j) = -tvec.at<double>(2); 
@@ -203,21 +515,30 @@ void four_point_groebner(cv::InputArray _points1, cv::InputArray _points2,
     _rvecs.getMat() *= angle; 
 }
 
+void four_point_groebner(cv::InputArray _points1, cv::InputArray _points2, 
+                double angle, double focal, cv::Point2d pp, 
+                cv::OutputArray _rvecs, cv::OutputArray _tvecs, int backend)
+{
+    FourPointGroebnerSolver solver(backend); 
+    four_point_groebner(_points1, _points2, angle, focal, pp, _rvecs, _tvecs, solver); 
+}
+
 
 class CvFourPointGroebnerEstimator : public CvModelEstimator2
 {
     double angle; 
+    FourPointGroebnerSolver solver; 
 public:
-    CvFourPointGroebnerEstimator( double _angle ); 
+    CvFourPointGroebnerEstimator( double _angle, int _backend ); 
     virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model ); 
 protected: 
     virtual void computeReprojError( const CvMat* m1, const CvMat* m2,
                                      const CvMat* model, CvMat* error );
 }; 
 
-CvFourPointGroebnerEstimator::CvFourPointGroebnerEstimator( double _angle )
-: CvModelEstimator2( 4, cvSize(6, 1),  400 ), 
-  angle( _angle ) 
+CvFourPointGroebnerEstimator::CvFourPointGroebnerEstimator( double _angle, int _backend )
+: CvModelEstimator2( 4, cvSize(6, 1),  200 ), 
+  angle( _angle ), solver( _backend ) 
 {
 }
 
@@ -230,18 +551,21 @@ int CvFourPointGroebnerEstimator::runKernel( const CvMat* q1, const CvMat* q2, C
 	Mat Q2 = Mat(q2).reshape(1, q2->cols); 
 
     Mat rvecs, tvecs; 
-    four_point_groebner(Q1, Q2, angle, 1.0, Point2d(0, 0), rvecs, tvecs); 
+    four_point_groebner(Q1, Q2, angle, 1.0, Point2d(0, 0), rvecs, tvecs, solver); 
     rvecs = rvecs.t(); 
     tvecs = tvecs.t(); 
     double * rt = _rvec_tvec->data.db; 
 
-    for (int i = 0; i < rvecs.rows; i++)
+    // The solutions come in pairs of +tvec and -tvec, which have the 
+    // same error. Only the +tvec one is scored, the sign is fixed after 
+    // RANSAC by a cheirality vote. 
+    for (int i = 0; i < rvecs.rows / 2; i++)
     {
-        memcpy(rt + i * 6, rvecs.ptr<double>(i), 3 * sizeof(double)); 
-        memcpy(rt + i * 6 + 3, tvecs.ptr<double>(i), 3 * sizeof(double)); 
+        memcpy(rt + i * 6, rvecs.ptr<double>(i * 2), 3 * sizeof(double)); 
+        memcpy(rt + i * 6 + 3, tvecs.ptr<double>(i * 2), 3 * sizeof(double)); 
     }
  
-    return rvecs.rows; 
+    return rvecs.rows / 2; 
 
 }
 
@@ -288,10 +612,48 @@ void CvFourPointGroebnerEstimator::computeReprojError( const CvMat* m1, const Cv
 
 }    
 
+/*
+ * t and -t give the same essential matrix up to sign, so RANSAC only 
+ * scores one of them. The sign is resolved by a cheirality vote: each 
+ * inlier is triangulated with +t, and it votes for +t if its depths in 
+ * both cameras are positive, or for -t if both are negative. 
+ * Returns true if -t wins. 
+ */
+static bool four_point_groebner_flip_translation(const Mat & points1, const Mat & points2, const Mat & mask, 
+               const Mat & rvec, const Mat & tvec)
+{
+    Mat rmat; 
+    Rodrigues(rvec, rmat); 
+    Matx33d R(rmat.ptr<double>()); 
+    Vec3d t(tvec.ptr<double>()); 
+
+    const Vec2d * x1s = points1.ptr<Vec2d>(); 
+    const Vec2d * x2s = points2.ptr<Vec2d>(); 
+    const uchar * m = mask.ptr<uchar>(); 
+    int n = points1.checkVector(2); 
+
+    int positive = 0, negative = 0; 
+    for (int i = 0; i < n; i++)
+    {
+        if (!m[i]) continue; 
+        Vec3d x1(x1s[i][0], x1s[i][1], 1.0); 
+        Vec3d x2(x2s[i][0], x2s[i][1], 1.0); 
+        Vec3d Rx1 = R * x1; 
+
+        // From d2 * x2 = d1 * R * x1 + t 
+        Vec3d a = x2.cross(Rx1), b = Rx1.cross(x2); 
+        double d1 = -x2.cross(t).dot(a); 
+        double d2 = Rx1.cross(t).dot(b); 
+        if (d1 > 0 && d2 > 0) positive++; 
+        else if (d1 < 0 && d2 < 0) negative++; 
+    }
+    return negative > positive; 
+}
+
 void findPose4pt_groebner(cv::InputArray _points1, cv::InputArray _points2, 
               double angle, double focal, cv::Point2d pp, 
               cv::OutputArray _rvecs, cv::OutputArray _tvecs, 
-              int method, double prob, double threshold, OutputArray _mask) 
+              int method, double prob, double threshold, OutputArray _mask, int backend, int maxIters) 
 {
 	Mat points1, points2; 
 	_points1.getMat().copyTo(points1); 
@@ -319,7 +681,7 @@ void findPose4pt_groebner(cv::InputArray _points1, cv::InputArray _points2,
 	points2 = points2.reshape(2, 1); 
 
 	Mat rvec_tvec(1, 6, CV_64F); 
-    CvFourPointGroebnerEstimator estimator(angle); 
+    CvFourPointGroebnerEstimator estimator(angle, backend); 
 
 	CvMat p1 = points1; 
 	CvMat p2 = points2; 
@@ -331,18 +693,18 @@ void findPose4pt_groebner(cv::InputArray _points1, cv::InputArray _points2,
     int count = 1; 
     if (npoints == 4)
     {
-        four_point_groebner(_points1, _points2, angle, focal, pp, _rvecs, _tvecs); 
+        four_point_groebner(_points1, _points2, angle, focal, pp, _rvecs, _tvecs, backend); 
         Mat(tempMask).setTo(true); 
     }
     else 
     {
         if (method == CV_RANSAC)
     	{
-    		estimator.runRANSAC(&p1, &p2, &_rvec_tvec, tempMask, threshold, prob); 
+    		estimator.runRANSAC(&p1, &p2, &_rvec_tvec, tempMask, threshold, prob, maxIters); 
     	}
     	else
     	{
-    		estimator.runLMeDS(&p1, &p2, &_rvec_tvec, tempMask, prob); 
+    		estimator.runLMeDS(&p1, &p2, &_rvec_tvec, tempMask, prob, maxIters); 
     	}
     
         if (_mask.needed())
@@ -379,14 +741,20 @@ void findPose4pt_groebner(cv::InputArray _points1, cv::InputArray _points2,
         }
         else 
         {
+            // The cheirality-consistent sign of tvec comes first
+            Mat rvec = rvec_tvec.colRange(0, 3).t() * 1.0; 
+            Mat tvec = rvec_tvec.colRange(3, 6).t() * 1.0; 
+            if (four_point_groebner_flip_translation(points1, points2, Mat(tempMask), rvec, tvec)) 
+                tvec = -tvec; 
+
             _rvecs.create(3, 2, CV_64F, -1, true); 
             _tvecs.create(3, 2, CV_64F, -1, true); 
     
-            _rvecs.getMat().col(0) = rvec_tvec.colRange(0, 3).t() * 1.0; 
-            _tvecs.getMat().col(0) = rvec_tvec.colRange(3, 6).t() * 1.0; 
+            _rvecs.getMat().col(0) = rvec * 1.0; 
+            _tvecs.getMat().col(0) = tvec * 1.0; 
     
-            _rvecs.getMat().col(1) = rvec_tvec.colRange(0, 3).t() * 1.0; 
-            _tvecs.getMat().col(1) = -rvec_tvec.colRange(3, 6).t() * 1.0; 
+            _rvecs.getMat().col(1) = rvec * 1.0; 
+            _tvecs.getMat().col(1) = -tvec * 1.0; 
 
         }
     }
@@ -395,12 +763,10 @@ void findPose4pt_groebner(cv::InputArray _points1, cv::InputArray _points2,
 }
 
 
-void four_point_groebner_helper(double p11, double p12, double p21, double p22, double p31, double p32, double p41, double p42,  
+void four_point_groebner_coeffs(double p11, double p12, double p21, double p22, double p31, double p32, double p41, double p42,  
                                 double q11, double q12, double q21, double q22, double q31, double q32, double q41, double q42, 
-                                double k1, double k3, SparseMatrix< double > & _M)
+                                double k1, double k3, double c[113])
 {
-    double c[113]; 
-
 	c[1] = -k1*p11+p11; 
 	c[2] = -k1*p12+p12; 
 	c[3] = k1*p11*q12-p11*q12; 
@@ -513,5560 +879,4 @@ void four_point_groebner_helper(double p11, double p12, double p21, double p22,
 	c[110] = 1; 
 	c[111] = 1; 
 	c[112] = -1; 
-    
-    std::vector<Triplet< double > > triplets; 
-    triplets.reserve(6000); 
-    triplets.push_back(Triplet< double >(228 - 1, 1 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(227 - 1, 2 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(226 - 1, 3 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(225 - 1, 4 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(224 - 1, 7 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(223 - 1, 8 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(222 - 1, 9 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(221 - 1, 12 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(220 - 1, 13 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(219 - 1, 16 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(218 - 1, 21 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(217 - 1, 22 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(216 - 1, 23 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(215 - 1, 24 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(214 - 1, 27 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(213 - 1, 28 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(212 - 1, 29 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(211 - 1, 32 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(210 - 1, 33 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(209 - 1, 36 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(135 - 1, 56 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(134 - 1, 57 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(133 - 1, 58 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(132 - 1, 59 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(131 - 1, 62 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(130 - 1, 63 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(129 - 1, 64 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(128 - 1, 67 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(127 - 1, 68 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(126 - 1, 71 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(125 - 1, 77 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(124 - 1, 78 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(123 - 1, 79 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(122 - 1, 82 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(121 - 1, 83 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(120 - 1, 86 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(119 - 1, 107 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(118 - 1, 108 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(117 - 1, 109 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(116 - 1, 112 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(115 - 1, 113 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(114 - 1, 116 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(57 - 1, 138 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(56 - 1, 139 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(55 - 1, 140 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(54 - 1, 143 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(53 - 1, 144 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(52 - 1, 147 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(51 - 1, 153 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(50 - 1, 154 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(49 - 1, 157 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(48 - 1, 176 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(47 - 1, 177 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(46 - 1, 180 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(15 - 1, 202 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(14 - 1, 203 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(13 - 1, 206 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(12 - 1, 212 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(11 - 1, 228 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(2 - 1, 250 - 1, c[1]));  
-	triplets.push_back(Triplet< double >(228 - 1, 2 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(227 - 1, 3 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(226 - 1, 4 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(225 - 1, 5 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(224 - 1, 8 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(223 - 1, 9 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(222 - 1, 10 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(221 - 1, 13 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(220 - 1, 14 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(219 - 1, 17 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(218 - 1, 22 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(217 - 1, 23 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(216 - 1, 24 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(215 - 1, 25 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(214 - 1, 28 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(213 - 1, 29 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(212 - 1, 30 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(211 - 1, 33 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(210 - 1, 34 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(209 - 1, 37 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(135 - 1, 57 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(134 - 1, 58 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(133 - 1, 59 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(132 - 1, 60 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(131 - 1, 63 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(130 - 1, 64 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(129 - 1, 65 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(128 - 1, 68 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(127 - 1, 69 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(126 - 1, 72 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(125 - 1, 78 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(124 - 1, 79 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(123 - 1, 80 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(122 - 1, 83 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(121 - 1, 84 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(120 - 1, 87 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(119 - 1, 108 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(118 - 1, 109 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(117 - 1, 110 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(116 - 1, 113 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(115 - 1, 114 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(114 - 1, 117 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(57 - 1, 139 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(56 - 1, 140 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(55 - 1, 141 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(54 - 1, 144 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(53 - 1, 145 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(52 - 1, 148 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(51 - 1, 154 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(50 - 1, 155 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(49 - 1, 158 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(48 - 1, 177 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(47 - 1, 178 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(46 - 1, 181 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(15 - 1, 203 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(14 - 1, 204 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(13 - 1, 207 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(12 - 1, 213 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(11 - 1, 229 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(2 - 1, 251 - 1, c[2]));  
-	triplets.push_back(Triplet< double >(228 - 1, 6 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(227 - 1, 7 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(226 - 1, 8 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(225 - 1, 9 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(224 - 1, 11 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(223 - 1, 12 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(222 - 1, 13 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(221 - 1, 15 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(220 - 1, 16 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(219 - 1, 18 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(218 - 1, 26 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(217 - 1, 27 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(216 - 1, 28 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(215 - 1, 29 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(214 - 1, 31 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(213 - 1, 32 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(212 - 1, 33 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(211 - 1, 35 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(210 - 1, 36 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(209 - 1, 38 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(135 - 1, 61 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(134 - 1, 62 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(133 - 1, 63 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(132 - 1, 64 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(131 - 1, 66 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(130 - 1, 67 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(129 - 1, 68 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(128 - 1, 70 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(127 - 1, 71 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(126 - 1, 73 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(125 - 1, 81 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(124 - 1, 82 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(123 - 1, 83 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(122 - 1, 85 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(121 - 1, 86 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(120 - 1, 88 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(119 - 1, 111 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(118 - 1, 112 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(117 - 1, 113 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(116 - 1, 115 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(115 - 1, 116 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(114 - 1, 118 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(57 - 1, 142 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(56 - 1, 143 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(55 - 1, 144 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(54 - 1, 146 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(53 - 1, 147 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(52 - 1, 149 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(51 - 1, 156 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(50 - 1, 157 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(49 - 1, 159 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(48 - 1, 179 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(47 - 1, 180 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(46 - 1, 182 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(15 - 1, 205 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(14 - 1, 206 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(13 - 1, 208 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(12 - 1, 214 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(11 - 1, 230 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(2 - 1, 252 - 1, c[3]));  
-	triplets.push_back(Triplet< double >(228 - 1, 7 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(227 - 1, 8 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(226 - 1, 9 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(225 - 1, 10 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(224 - 1, 12 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(223 - 1, 13 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(222 - 1, 14 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(221 - 1, 16 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(220 - 1, 17 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(219 - 1, 19 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(218 - 1, 27 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(217 - 1, 28 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(216 - 1, 29 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(215 - 1, 30 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(214 - 1, 32 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(213 - 1, 33 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(212 - 1, 34 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(211 - 1, 36 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(210 - 1, 37 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(209 - 1, 39 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(135 - 1, 62 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(134 - 1, 63 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(133 - 1, 64 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(132 - 1, 65 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(131 - 1, 67 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(130 - 1, 68 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(129 - 1, 69 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(128 - 1, 71 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(127 - 1, 72 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(126 - 1, 74 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(125 - 1, 82 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(124 - 1, 83 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(123 - 1, 84 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(122 - 1, 86 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(121 - 1, 87 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(120 - 1, 89 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(119 - 1, 112 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(118 - 1, 113 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(117 - 1, 114 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(116 - 1, 116 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(115 - 1, 117 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(114 - 1, 119 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(57 - 1, 143 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(56 - 1, 144 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(55 - 1, 145 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(54 - 1, 147 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(53 - 1, 148 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(52 - 1, 150 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(51 - 1, 157 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(50 - 1, 158 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(49 - 1, 160 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(48 - 1, 180 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(47 - 1, 181 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(46 - 1, 183 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(15 - 1, 206 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(14 - 1, 207 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(13 - 1, 209 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(12 - 1, 215 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(11 - 1, 231 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(2 - 1, 253 - 1, c[4]));  
-	triplets.push_back(Triplet< double >(228 - 1, 11 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(227 - 1, 12 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(226 - 1, 13 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(225 - 1, 14 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(224 - 1, 15 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(223 - 1, 16 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(222 - 1, 17 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(221 - 1, 18 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(220 - 1, 19 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(219 - 1, 20 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(218 - 1, 31 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(217 - 1, 32 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(216 - 1, 33 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(215 - 1, 34 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(214 - 1, 35 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(213 - 1, 36 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(212 - 1, 37 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(211 - 1, 38 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(210 - 1, 39 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(209 - 1, 40 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(135 - 1, 66 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(134 - 1, 67 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(133 - 1, 68 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(132 - 1, 69 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(131 - 1, 70 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(130 - 1, 71 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(129 - 1, 72 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(128 - 1, 73 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(127 - 1, 74 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(126 - 1, 75 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(125 - 1, 85 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(124 - 1, 86 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(123 - 1, 87 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(122 - 1, 88 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(121 - 1, 89 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(120 - 1, 90 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(119 - 1, 115 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(118 - 1, 116 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(117 - 1, 117 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(116 - 1, 118 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(115 - 1, 119 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(114 - 1, 120 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(57 - 1, 146 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(56 - 1, 147 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(55 - 1, 148 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(54 - 1, 149 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(53 - 1, 150 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(52 - 1, 151 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(51 - 1, 159 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(50 - 1, 160 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(49 - 1, 161 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(48 - 1, 182 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(47 - 1, 183 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(46 - 1, 184 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(15 - 1, 208 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(14 - 1, 209 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(13 - 1, 210 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(12 - 1, 216 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(11 - 1, 232 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(2 - 1, 254 - 1, c[5]));  
-	triplets.push_back(Triplet< double >(227 - 1, 21 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(226 - 1, 22 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(225 - 1, 23 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(224 - 1, 26 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(223 - 1, 27 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(222 - 1, 28 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(221 - 1, 31 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(220 - 1, 32 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(219 - 1, 35 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(214 - 1, 41 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(213 - 1, 42 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(212 - 1, 43 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(211 - 1, 46 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(210 - 1, 47 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(209 - 1, 50 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(131 - 1, 91 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(130 - 1, 92 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(129 - 1, 93 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(128 - 1, 96 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(127 - 1, 97 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(126 - 1, 100 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(125 - 1, 106 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(124 - 1, 107 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(123 - 1, 108 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(122 - 1, 111 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(121 - 1, 112 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(120 - 1, 115 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(119 - 1, 121 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(118 - 1, 122 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(117 - 1, 123 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(116 - 1, 124 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(115 - 1, 125 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(114 - 1, 128 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(57 - 1, 162 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(56 - 1, 163 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(55 - 1, 164 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(54 - 1, 165 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(53 - 1, 166 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(52 - 1, 169 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(51 - 1, 175 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(50 - 1, 176 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(49 - 1, 179 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(48 - 1, 185 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(47 - 1, 186 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(46 - 1, 189 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(15 - 1, 217 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(14 - 1, 218 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(13 - 1, 221 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(12 - 1, 227 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(11 - 1, 233 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(2 - 1, 258 - 1, c[6]));  
-	triplets.push_back(Triplet< double >(228 - 1, 21 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(227 - 1, 22 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(226 - 1, 23 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(225 - 1, 24 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(224 - 1, 27 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(223 - 1, 28 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(222 - 1, 29 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(221 - 1, 32 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(220 - 1, 33 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(219 - 1, 36 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(214 - 1, 42 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(213 - 1, 43 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(212 - 1, 44 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(211 - 1, 47 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(210 - 1, 48 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(209 - 1, 51 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(131 - 1, 92 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(130 - 1, 93 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(129 - 1, 94 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(128 - 1, 97 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(127 - 1, 98 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(126 - 1, 101 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(125 - 1, 107 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(124 - 1, 108 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(123 - 1, 109 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(122 - 1, 112 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(121 - 1, 113 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(120 - 1, 116 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(119 - 1, 122 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(118 - 1, 123 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(116 - 1, 125 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(115 - 1, 126 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(114 - 1, 129 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(57 - 1, 163 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(56 - 1, 164 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(54 - 1, 166 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(53 - 1, 167 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(52 - 1, 170 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(51 - 1, 176 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(50 - 1, 177 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(49 - 1, 180 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(48 - 1, 186 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(47 - 1, 187 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(46 - 1, 190 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(15 - 1, 218 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(14 - 1, 219 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(13 - 1, 222 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(12 - 1, 228 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(11 - 1, 234 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(2 - 1, 259 - 1, c[7]));  
-	triplets.push_back(Triplet< double >(228 - 1, 26 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(227 - 1, 27 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(226 - 1, 28 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(225 - 1, 29 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(224 - 1, 31 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(223 - 1, 32 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(222 - 1, 33 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(221 - 1, 35 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(220 - 1, 36 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(219 - 1, 38 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(218 - 1, 41 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(217 - 1, 42 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(216 - 1, 43 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(215 - 1, 44 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(214 - 1, 46 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(213 - 1, 47 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(212 - 1, 48 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(211 - 1, 50 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(210 - 1, 51 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(209 - 1, 53 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(135 - 1, 91 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(134 - 1, 92 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(133 - 1, 93 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(132 - 1, 94 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(131 - 1, 96 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(130 - 1, 97 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(129 - 1, 98 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(128 - 1, 100 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(127 - 1, 101 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(126 - 1, 103 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(125 - 1, 111 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(124 - 1, 112 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(123 - 1, 113 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(122 - 1, 115 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(121 - 1, 116 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(120 - 1, 118 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(119 - 1, 124 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(118 - 1, 125 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(117 - 1, 126 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(116 - 1, 128 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(115 - 1, 129 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(114 - 1, 131 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(57 - 1, 165 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(56 - 1, 166 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(55 - 1, 167 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(54 - 1, 169 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(53 - 1, 170 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(52 - 1, 172 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(51 - 1, 179 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(50 - 1, 180 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(49 - 1, 182 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(48 - 1, 189 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(47 - 1, 190 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(46 - 1, 192 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(15 - 1, 221 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(14 - 1, 222 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(13 - 1, 224 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(12 - 1, 230 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(11 - 1, 236 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(2 - 1, 261 - 1, c[8]));  
-	triplets.push_back(Triplet< double >(228 - 1, 27 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(227 - 1, 28 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(226 - 1, 29 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(225 - 1, 30 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(224 - 1, 32 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(223 - 1, 33 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(222 - 1, 34 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(221 - 1, 36 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(220 - 1, 37 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(219 - 1, 39 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(218 - 1, 42 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(217 - 1, 43 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(216 - 1, 44 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(215 - 1, 45 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(214 - 1, 47 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(213 - 1, 48 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(212 - 1, 49 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(211 - 1, 51 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(210 - 1, 52 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(209 - 1, 54 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(135 - 1, 92 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(134 - 1, 93 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(133 - 1, 94 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(132 - 1, 95 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(131 - 1, 97 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(130 - 1, 98 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(129 - 1, 99 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(128 - 1, 101 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(127 - 1, 102 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(126 - 1, 104 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(125 - 1, 112 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(124 - 1, 113 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(123 - 1, 114 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(122 - 1, 116 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(121 - 1, 117 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(120 - 1, 119 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(119 - 1, 125 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(118 - 1, 126 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(117 - 1, 127 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(116 - 1, 129 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(115 - 1, 130 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(114 - 1, 132 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(57 - 1, 166 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(56 - 1, 167 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(55 - 1, 168 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(54 - 1, 170 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(53 - 1, 171 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(52 - 1, 173 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(51 - 1, 180 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(50 - 1, 181 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(49 - 1, 183 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(48 - 1, 190 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(47 - 1, 191 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(46 - 1, 193 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(15 - 1, 222 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(14 - 1, 223 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(13 - 1, 225 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(12 - 1, 231 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(11 - 1, 237 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(2 - 1, 262 - 1, c[9]));  
-	triplets.push_back(Triplet< double >(228 - 1, 31 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(227 - 1, 32 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(226 - 1, 33 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(225 - 1, 34 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(224 - 1, 35 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(223 - 1, 36 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(222 - 1, 37 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(221 - 1, 38 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(220 - 1, 39 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(219 - 1, 40 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(218 - 1, 46 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(217 - 1, 47 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(216 - 1, 48 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(215 - 1, 49 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(214 - 1, 50 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(213 - 1, 51 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(212 - 1, 52 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(211 - 1, 53 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(210 - 1, 54 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(209 - 1, 55 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(135 - 1, 96 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(134 - 1, 97 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(133 - 1, 98 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(132 - 1, 99 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(131 - 1, 100 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(130 - 1, 101 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(129 - 1, 102 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(128 - 1, 103 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(127 - 1, 104 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(126 - 1, 105 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(125 - 1, 115 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(124 - 1, 116 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(123 - 1, 117 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(122 - 1, 118 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(121 - 1, 119 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(120 - 1, 120 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(119 - 1, 128 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(118 - 1, 129 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(117 - 1, 130 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(116 - 1, 131 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(115 - 1, 132 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(114 - 1, 133 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(57 - 1, 169 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(56 - 1, 170 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(55 - 1, 171 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(54 - 1, 172 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(53 - 1, 173 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(52 - 1, 174 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(51 - 1, 182 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(50 - 1, 183 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(49 - 1, 184 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(48 - 1, 192 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(47 - 1, 193 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(46 - 1, 194 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(15 - 1, 224 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(14 - 1, 225 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(13 - 1, 226 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(12 - 1, 232 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(11 - 1, 238 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(2 - 1, 263 - 1, c[10]));  
-	triplets.push_back(Triplet< double >(227 - 1, 56 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(226 - 1, 57 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(225 - 1, 58 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(224 - 1, 61 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(223 - 1, 62 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(222 - 1, 63 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(221 - 1, 66 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(220 - 1, 67 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(219 - 1, 70 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(214 - 1, 91 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(213 - 1, 92 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(212 - 1, 93 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(211 - 1, 96 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(210 - 1, 97 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(209 - 1, 100 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(130 - 1, 134 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(129 - 1, 135 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(127 - 1, 136 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(125 - 1, 137 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(124 - 1, 138 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(123 - 1, 139 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(122 - 1, 142 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(121 - 1, 143 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(120 - 1, 146 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(119 - 1, 162 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(118 - 1, 163 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(117 - 1, 164 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(116 - 1, 165 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(115 - 1, 166 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(114 - 1, 169 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(57 - 1, 195 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(56 - 1, 196 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(55 - 1, 197 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(54 - 1, 198 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(53 - 1, 199 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(52 - 1, 200 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(51 - 1, 201 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(50 - 1, 202 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(49 - 1, 205 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(48 - 1, 217 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(47 - 1, 218 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(46 - 1, 221 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(15 - 1, 239 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(14 - 1, 240 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(13 - 1, 243 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(12 - 1, 249 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(11 - 1, 258 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(2 - 1, 270 - 1, c[11]));  
-	triplets.push_back(Triplet< double >(228 - 1, 56 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(227 - 1, 57 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(226 - 1, 58 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(225 - 1, 59 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(224 - 1, 62 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(223 - 1, 63 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(222 - 1, 64 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(221 - 1, 67 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(220 - 1, 68 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(219 - 1, 71 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(214 - 1, 92 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(213 - 1, 93 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(212 - 1, 94 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(211 - 1, 97 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(210 - 1, 98 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(209 - 1, 101 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(131 - 1, 134 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(130 - 1, 135 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(128 - 1, 136 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(125 - 1, 138 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(124 - 1, 139 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(123 - 1, 140 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(122 - 1, 143 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(121 - 1, 144 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(120 - 1, 147 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(119 - 1, 163 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(118 - 1, 164 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(116 - 1, 166 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(115 - 1, 167 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(114 - 1, 170 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(57 - 1, 196 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(56 - 1, 197 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(54 - 1, 199 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(51 - 1, 202 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(50 - 1, 203 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(49 - 1, 206 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(48 - 1, 218 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(47 - 1, 219 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(46 - 1, 222 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(15 - 1, 240 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(14 - 1, 241 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(13 - 1, 244 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(12 - 1, 250 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(11 - 1, 259 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(2 - 1, 271 - 1, c[12]));  
-	triplets.push_back(Triplet< double >(228 - 1, 57 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(227 - 1, 58 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(226 - 1, 59 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(225 - 1, 60 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(224 - 1, 63 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(223 - 1, 64 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(222 - 1, 65 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(221 - 1, 68 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(220 - 1, 69 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(219 - 1, 72 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(214 - 1, 93 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(213 - 1, 94 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(212 - 1, 95 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(211 - 1, 98 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(210 - 1, 99 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(209 - 1, 102 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(131 - 1, 135 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(125 - 1, 139 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(124 - 1, 140 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(123 - 1, 141 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(122 - 1, 144 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(121 - 1, 145 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(120 - 1, 148 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(119 - 1, 164 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(116 - 1, 167 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(115 - 1, 168 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(114 - 1, 171 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(57 - 1, 197 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(51 - 1, 203 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(50 - 1, 204 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(49 - 1, 207 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(48 - 1, 219 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(47 - 1, 220 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(46 - 1, 223 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(15 - 1, 241 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(14 - 1, 242 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(13 - 1, 245 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(12 - 1, 251 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(11 - 1, 260 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(2 - 1, 272 - 1, c[13]));  
-	triplets.push_back(Triplet< double >(228 - 1, 61 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(227 - 1, 62 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(226 - 1, 63 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(225 - 1, 64 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(224 - 1, 66 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(223 - 1, 67 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(222 - 1, 68 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(221 - 1, 70 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(220 - 1, 71 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(219 - 1, 73 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(218 - 1, 91 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(217 - 1, 92 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(216 - 1, 93 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(215 - 1, 94 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(214 - 1, 96 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(213 - 1, 97 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(212 - 1, 98 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(211 - 1, 100 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(210 - 1, 101 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(209 - 1, 103 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(134 - 1, 134 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(133 - 1, 135 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(130 - 1, 136 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(125 - 1, 142 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(124 - 1, 143 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(123 - 1, 144 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(122 - 1, 146 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(121 - 1, 147 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(120 - 1, 149 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(119 - 1, 165 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(118 - 1, 166 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(117 - 1, 167 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(116 - 1, 169 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(115 - 1, 170 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(114 - 1, 172 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(57 - 1, 198 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(56 - 1, 199 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(54 - 1, 200 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(51 - 1, 205 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(50 - 1, 206 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(49 - 1, 208 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(48 - 1, 221 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(47 - 1, 222 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(46 - 1, 224 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(15 - 1, 243 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(14 - 1, 244 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(13 - 1, 246 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(12 - 1, 252 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(11 - 1, 261 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(2 - 1, 273 - 1, c[14]));  
-	triplets.push_back(Triplet< double >(228 - 1, 62 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(227 - 1, 63 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(226 - 1, 64 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(225 - 1, 65 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(224 - 1, 67 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(223 - 1, 68 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(222 - 1, 69 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(221 - 1, 71 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(220 - 1, 72 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(219 - 1, 74 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(218 - 1, 92 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(217 - 1, 93 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(216 - 1, 94 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(215 - 1, 95 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(214 - 1, 97 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(213 - 1, 98 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(212 - 1, 99 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(211 - 1, 101 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(210 - 1, 102 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(209 - 1, 104 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(135 - 1, 134 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(134 - 1, 135 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(131 - 1, 136 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(125 - 1, 143 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(124 - 1, 144 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(123 - 1, 145 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(122 - 1, 147 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(121 - 1, 148 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(120 - 1, 150 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(119 - 1, 166 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(118 - 1, 167 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(117 - 1, 168 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(116 - 1, 170 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(115 - 1, 171 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(114 - 1, 173 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(57 - 1, 199 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(51 - 1, 206 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(50 - 1, 207 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(49 - 1, 209 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(48 - 1, 222 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(47 - 1, 223 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(46 - 1, 225 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(15 - 1, 244 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(14 - 1, 245 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(13 - 1, 247 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(12 - 1, 253 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(11 - 1, 262 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(2 - 1, 274 - 1, c[15]));  
-	triplets.push_back(Triplet< double >(228 - 1, 76 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(227 - 1, 77 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(226 - 1, 78 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(225 - 1, 79 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(224 - 1, 81 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(223 - 1, 82 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(222 - 1, 83 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(221 - 1, 85 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(220 - 1, 86 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(219 - 1, 88 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(218 - 1, 106 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(217 - 1, 107 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(216 - 1, 108 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(215 - 1, 109 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(214 - 1, 111 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(213 - 1, 112 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(212 - 1, 113 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(211 - 1, 115 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(210 - 1, 116 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(209 - 1, 118 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(135 - 1, 137 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(134 - 1, 138 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(133 - 1, 139 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(132 - 1, 140 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(131 - 1, 142 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(130 - 1, 143 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(129 - 1, 144 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(128 - 1, 146 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(127 - 1, 147 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(126 - 1, 149 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(125 - 1, 152 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(124 - 1, 153 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(123 - 1, 154 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(122 - 1, 156 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(121 - 1, 157 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(120 - 1, 159 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(119 - 1, 175 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(118 - 1, 176 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(117 - 1, 177 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(116 - 1, 179 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(115 - 1, 180 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(114 - 1, 182 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(57 - 1, 201 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(56 - 1, 202 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(55 - 1, 203 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(54 - 1, 205 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(53 - 1, 206 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(52 - 1, 208 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(51 - 1, 211 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(50 - 1, 212 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(49 - 1, 214 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(48 - 1, 227 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(47 - 1, 228 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(46 - 1, 230 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(15 - 1, 249 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(14 - 1, 250 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(13 - 1, 252 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(12 - 1, 255 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(11 - 1, 264 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(2 - 1, 276 - 1, c[16]));  
-	triplets.push_back(Triplet< double >(228 - 1, 77 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(227 - 1, 78 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(226 - 1, 79 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(225 - 1, 80 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(224 - 1, 82 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(223 - 1, 83 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(222 - 1, 84 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(221 - 1, 86 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(220 - 1, 87 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(219 - 1, 89 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(218 - 1, 107 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(217 - 1, 108 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(216 - 1, 109 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(215 - 1, 110 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(214 - 1, 112 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(213 - 1, 113 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(212 - 1, 114 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(211 - 1, 116 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(210 - 1, 117 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(209 - 1, 119 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(135 - 1, 138 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(134 - 1, 139 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(133 - 1, 140 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(132 - 1, 141 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(131 - 1, 143 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(130 - 1, 144 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(129 - 1, 145 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(128 - 1, 147 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(127 - 1, 148 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(126 - 1, 150 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(125 - 1, 153 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(124 - 1, 154 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(123 - 1, 155 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(122 - 1, 157 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(121 - 1, 158 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(120 - 1, 160 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(119 - 1, 176 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(118 - 1, 177 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(117 - 1, 178 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(116 - 1, 180 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(115 - 1, 181 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(114 - 1, 183 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(57 - 1, 202 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(56 - 1, 203 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(55 - 1, 204 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(54 - 1, 206 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(53 - 1, 207 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(52 - 1, 209 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(51 - 1, 212 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(50 - 1, 213 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(49 - 1, 215 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(48 - 1, 228 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(47 - 1, 229 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(46 - 1, 231 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(15 - 1, 250 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(14 - 1, 251 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(13 - 1, 253 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(12 - 1, 256 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(11 - 1, 265 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(2 - 1, 277 - 1, c[17]));  
-	triplets.push_back(Triplet< double >(228 - 1, 81 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(227 - 1, 82 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(226 - 1, 83 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(225 - 1, 84 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(224 - 1, 85 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(223 - 1, 86 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(222 - 1, 87 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(221 - 1, 88 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(220 - 1, 89 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(219 - 1, 90 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(218 - 1, 111 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(217 - 1, 112 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(216 - 1, 113 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(215 - 1, 114 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(214 - 1, 115 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(213 - 1, 116 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(212 - 1, 117 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(211 - 1, 118 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(210 - 1, 119 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(209 - 1, 120 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(135 - 1, 142 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(134 - 1, 143 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(133 - 1, 144 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(132 - 1, 145 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(131 - 1, 146 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(130 - 1, 147 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(129 - 1, 148 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(128 - 1, 149 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(127 - 1, 150 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(126 - 1, 151 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(125 - 1, 156 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(124 - 1, 157 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(123 - 1, 158 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(122 - 1, 159 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(121 - 1, 160 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(120 - 1, 161 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(119 - 1, 179 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(118 - 1, 180 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(117 - 1, 181 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(116 - 1, 182 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(115 - 1, 183 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(114 - 1, 184 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(57 - 1, 205 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(56 - 1, 206 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(55 - 1, 207 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(54 - 1, 208 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(53 - 1, 209 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(52 - 1, 210 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(51 - 1, 214 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(50 - 1, 215 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(49 - 1, 216 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(48 - 1, 230 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(47 - 1, 231 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(46 - 1, 232 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(15 - 1, 252 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(14 - 1, 253 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(13 - 1, 254 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(12 - 1, 257 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(11 - 1, 266 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(2 - 1, 278 - 1, c[18]));  
-	triplets.push_back(Triplet< double >(228 - 1, 106 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(227 - 1, 107 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(226 - 1, 108 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(225 - 1, 109 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(224 - 1, 111 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(223 - 1, 112 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(222 - 1, 113 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(221 - 1, 115 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(220 - 1, 116 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(219 - 1, 118 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(218 - 1, 121 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(217 - 1, 122 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(216 - 1, 123 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(214 - 1, 124 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(213 - 1, 125 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(212 - 1, 126 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(211 - 1, 128 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(210 - 1, 129 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(209 - 1, 131 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(135 - 1, 162 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(134 - 1, 163 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(133 - 1, 164 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(131 - 1, 165 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(130 - 1, 166 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(129 - 1, 167 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(128 - 1, 169 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(127 - 1, 170 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(126 - 1, 172 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(125 - 1, 175 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(124 - 1, 176 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(123 - 1, 177 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(122 - 1, 179 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(121 - 1, 180 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(120 - 1, 182 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(119 - 1, 185 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(118 - 1, 186 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(117 - 1, 187 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(116 - 1, 189 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(115 - 1, 190 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(114 - 1, 192 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(57 - 1, 217 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(56 - 1, 218 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(55 - 1, 219 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(54 - 1, 221 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(53 - 1, 222 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(52 - 1, 224 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(51 - 1, 227 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(50 - 1, 228 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(49 - 1, 230 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(48 - 1, 233 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(47 - 1, 234 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(46 - 1, 236 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(15 - 1, 258 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(14 - 1, 259 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(13 - 1, 261 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(12 - 1, 264 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(11 - 1, 267 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(2 - 1, 280 - 1, c[19]));  
-	triplets.push_back(Triplet< double >(228 - 1, 107 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(227 - 1, 108 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(226 - 1, 109 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(225 - 1, 110 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(224 - 1, 112 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(223 - 1, 113 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(222 - 1, 114 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(221 - 1, 116 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(220 - 1, 117 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(219 - 1, 119 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(218 - 1, 122 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(217 - 1, 123 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(214 - 1, 125 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(213 - 1, 126 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(212 - 1, 127 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(211 - 1, 129 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(210 - 1, 130 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(209 - 1, 132 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(135 - 1, 163 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(134 - 1, 164 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(131 - 1, 166 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(130 - 1, 167 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(129 - 1, 168 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(128 - 1, 170 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(127 - 1, 171 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(126 - 1, 173 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(125 - 1, 176 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(124 - 1, 177 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(123 - 1, 178 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(122 - 1, 180 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(121 - 1, 181 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(120 - 1, 183 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(119 - 1, 186 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(118 - 1, 187 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(117 - 1, 188 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(116 - 1, 190 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(115 - 1, 191 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(114 - 1, 193 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(57 - 1, 218 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(56 - 1, 219 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(55 - 1, 220 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(54 - 1, 222 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(53 - 1, 223 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(52 - 1, 225 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(51 - 1, 228 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(50 - 1, 229 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(49 - 1, 231 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(48 - 1, 234 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(47 - 1, 235 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(46 - 1, 237 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(15 - 1, 259 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(14 - 1, 260 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(13 - 1, 262 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(12 - 1, 265 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(11 - 1, 268 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(2 - 1, 281 - 1, c[20]));  
-	triplets.push_back(Triplet< double >(228 - 1, 111 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(227 - 1, 112 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(226 - 1, 113 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(225 - 1, 114 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(224 - 1, 115 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(223 - 1, 116 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(222 - 1, 117 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(221 - 1, 118 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(220 - 1, 119 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(219 - 1, 120 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(218 - 1, 124 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(217 - 1, 125 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(216 - 1, 126 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(215 - 1, 127 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(214 - 1, 128 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(213 - 1, 129 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(212 - 1, 130 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(211 - 1, 131 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(210 - 1, 132 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(209 - 1, 133 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(135 - 1, 165 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(134 - 1, 166 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(133 - 1, 167 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(132 - 1, 168 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(131 - 1, 169 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(130 - 1, 170 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(129 - 1, 171 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(128 - 1, 172 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(127 - 1, 173 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(126 - 1, 174 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(125 - 1, 179 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(124 - 1, 180 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(123 - 1, 181 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(122 - 1, 182 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(121 - 1, 183 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(120 - 1, 184 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(119 - 1, 189 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(118 - 1, 190 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(117 - 1, 191 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(116 - 1, 192 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(115 - 1, 193 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(114 - 1, 194 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(57 - 1, 221 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(56 - 1, 222 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(55 - 1, 223 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(54 - 1, 224 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(53 - 1, 225 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(52 - 1, 226 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(51 - 1, 230 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(50 - 1, 231 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(49 - 1, 232 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(48 - 1, 236 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(47 - 1, 237 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(46 - 1, 238 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(15 - 1, 261 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(14 - 1, 262 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(13 - 1, 263 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(12 - 1, 266 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(11 - 1, 269 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(2 - 1, 282 - 1, c[21]));  
-	triplets.push_back(Triplet< double >(228 - 1, 137 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(227 - 1, 138 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(226 - 1, 139 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(225 - 1, 140 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(224 - 1, 142 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(223 - 1, 143 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(222 - 1, 144 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(221 - 1, 146 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(220 - 1, 147 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(219 - 1, 149 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(218 - 1, 162 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(217 - 1, 163 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(216 - 1, 164 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(214 - 1, 165 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(213 - 1, 166 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(212 - 1, 167 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(211 - 1, 169 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(210 - 1, 170 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(209 - 1, 172 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(135 - 1, 195 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(134 - 1, 196 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(133 - 1, 197 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(131 - 1, 198 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(130 - 1, 199 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(128 - 1, 200 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(125 - 1, 201 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(124 - 1, 202 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(123 - 1, 203 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(122 - 1, 205 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(121 - 1, 206 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(120 - 1, 208 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(119 - 1, 217 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(118 - 1, 218 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(117 - 1, 219 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(116 - 1, 221 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(115 - 1, 222 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(114 - 1, 224 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(57 - 1, 239 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(56 - 1, 240 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(55 - 1, 241 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(54 - 1, 243 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(53 - 1, 244 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(52 - 1, 246 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(51 - 1, 249 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(50 - 1, 250 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(49 - 1, 252 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(48 - 1, 258 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(47 - 1, 259 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(46 - 1, 261 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(15 - 1, 270 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(14 - 1, 271 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(13 - 1, 273 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(12 - 1, 276 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(11 - 1, 280 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(2 - 1, 285 - 1, c[22]));  
-	triplets.push_back(Triplet< double >(228 - 1, 138 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(227 - 1, 139 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(226 - 1, 140 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(225 - 1, 141 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(224 - 1, 143 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(223 - 1, 144 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(222 - 1, 145 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(221 - 1, 147 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(220 - 1, 148 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(219 - 1, 150 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(218 - 1, 163 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(217 - 1, 164 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(214 - 1, 166 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(213 - 1, 167 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(212 - 1, 168 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(211 - 1, 170 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(210 - 1, 171 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(209 - 1, 173 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(135 - 1, 196 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(134 - 1, 197 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(131 - 1, 199 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(125 - 1, 202 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(124 - 1, 203 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(123 - 1, 204 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(122 - 1, 206 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(121 - 1, 207 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(120 - 1, 209 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(119 - 1, 218 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(118 - 1, 219 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(117 - 1, 220 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(116 - 1, 222 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(115 - 1, 223 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(114 - 1, 225 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(57 - 1, 240 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(56 - 1, 241 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(55 - 1, 242 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(54 - 1, 244 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(53 - 1, 245 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(52 - 1, 247 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(51 - 1, 250 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(50 - 1, 251 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(49 - 1, 253 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(48 - 1, 259 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(47 - 1, 260 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(46 - 1, 262 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(15 - 1, 271 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(14 - 1, 272 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(13 - 1, 274 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(12 - 1, 277 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(11 - 1, 281 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(2 - 1, 286 - 1, c[23]));  
-	triplets.push_back(Triplet< double >(228 - 1, 142 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(227 - 1, 143 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(226 - 1, 144 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(225 - 1, 145 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(224 - 1, 146 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(223 - 1, 147 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(222 - 1, 148 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(221 - 1, 149 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(220 - 1, 150 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(219 - 1, 151 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(218 - 1, 165 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(217 - 1, 166 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(216 - 1, 167 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(215 - 1, 168 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(214 - 1, 169 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(213 - 1, 170 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(212 - 1, 171 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(211 - 1, 172 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(210 - 1, 173 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(209 - 1, 174 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(135 - 1, 198 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(134 - 1, 199 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(131 - 1, 200 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(125 - 1, 205 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(124 - 1, 206 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(123 - 1, 207 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(122 - 1, 208 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(121 - 1, 209 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(120 - 1, 210 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(119 - 1, 221 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(118 - 1, 222 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(117 - 1, 223 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(116 - 1, 224 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(115 - 1, 225 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(114 - 1, 226 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(57 - 1, 243 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(56 - 1, 244 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(55 - 1, 245 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(54 - 1, 246 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(53 - 1, 247 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(52 - 1, 248 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(51 - 1, 252 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(50 - 1, 253 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(49 - 1, 254 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(48 - 1, 261 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(47 - 1, 262 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(46 - 1, 263 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(15 - 1, 273 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(14 - 1, 274 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(13 - 1, 275 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(12 - 1, 278 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(11 - 1, 282 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(2 - 1, 287 - 1, c[24]));  
-	triplets.push_back(Triplet< double >(228 - 1, 152 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(227 - 1, 153 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(226 - 1, 154 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(225 - 1, 155 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(224 - 1, 156 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(223 - 1, 157 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(222 - 1, 158 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(221 - 1, 159 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(220 - 1, 160 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(219 - 1, 161 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(218 - 1, 175 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(217 - 1, 176 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(216 - 1, 177 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(215 - 1, 178 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(214 - 1, 179 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(213 - 1, 180 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(212 - 1, 181 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(211 - 1, 182 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(210 - 1, 183 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(209 - 1, 184 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(135 - 1, 201 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(134 - 1, 202 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(133 - 1, 203 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(132 - 1, 204 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(131 - 1, 205 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(130 - 1, 206 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(129 - 1, 207 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(128 - 1, 208 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(127 - 1, 209 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(126 - 1, 210 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(125 - 1, 211 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(124 - 1, 212 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(123 - 1, 213 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(122 - 1, 214 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(121 - 1, 215 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(120 - 1, 216 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(119 - 1, 227 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(118 - 1, 228 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(117 - 1, 229 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(116 - 1, 230 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(115 - 1, 231 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(114 - 1, 232 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(57 - 1, 249 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(56 - 1, 250 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(55 - 1, 251 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(54 - 1, 252 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(53 - 1, 253 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(52 - 1, 254 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(51 - 1, 255 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(50 - 1, 256 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(49 - 1, 257 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(48 - 1, 264 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(47 - 1, 265 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(46 - 1, 266 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(15 - 1, 276 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(14 - 1, 277 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(13 - 1, 278 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(12 - 1, 279 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(11 - 1, 283 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(2 - 1, 288 - 1, c[25]));  
-	triplets.push_back(Triplet< double >(228 - 1, 175 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(227 - 1, 176 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(226 - 1, 177 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(225 - 1, 178 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(224 - 1, 179 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(223 - 1, 180 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(222 - 1, 181 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(221 - 1, 182 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(220 - 1, 183 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(219 - 1, 184 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(218 - 1, 185 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(217 - 1, 186 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(216 - 1, 187 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(215 - 1, 188 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(214 - 1, 189 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(213 - 1, 190 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(212 - 1, 191 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(211 - 1, 192 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(210 - 1, 193 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(209 - 1, 194 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(135 - 1, 217 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(134 - 1, 218 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(133 - 1, 219 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(132 - 1, 220 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(131 - 1, 221 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(130 - 1, 222 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(129 - 1, 223 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(128 - 1, 224 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(127 - 1, 225 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(126 - 1, 226 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(125 - 1, 227 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(124 - 1, 228 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(123 - 1, 229 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(122 - 1, 230 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(121 - 1, 231 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(120 - 1, 232 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(119 - 1, 233 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(118 - 1, 234 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(117 - 1, 235 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(116 - 1, 236 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(115 - 1, 237 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(114 - 1, 238 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(57 - 1, 258 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(56 - 1, 259 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(55 - 1, 260 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(54 - 1, 261 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(53 - 1, 262 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(52 - 1, 263 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(51 - 1, 264 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(50 - 1, 265 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(49 - 1, 266 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(48 - 1, 267 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(47 - 1, 268 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(46 - 1, 269 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(15 - 1, 280 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(14 - 1, 281 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(13 - 1, 282 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(12 - 1, 283 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(11 - 1, 284 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(2 - 1, 289 - 1, c[26]));  
-	triplets.push_back(Triplet< double >(228 - 1, 201 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(227 - 1, 202 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(226 - 1, 203 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(225 - 1, 204 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(224 - 1, 205 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(223 - 1, 206 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(222 - 1, 207 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(221 - 1, 208 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(220 - 1, 209 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(219 - 1, 210 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(218 - 1, 217 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(217 - 1, 218 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(216 - 1, 219 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(215 - 1, 220 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(214 - 1, 221 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(213 - 1, 222 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(212 - 1, 223 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(211 - 1, 224 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(210 - 1, 225 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(209 - 1, 226 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(135 - 1, 239 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(134 - 1, 240 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(133 - 1, 241 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(132 - 1, 242 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(131 - 1, 243 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(130 - 1, 244 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(129 - 1, 245 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(128 - 1, 246 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(127 - 1, 247 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(126 - 1, 248 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(125 - 1, 249 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(124 - 1, 250 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(123 - 1, 251 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(122 - 1, 252 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(121 - 1, 253 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(120 - 1, 254 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(119 - 1, 258 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(118 - 1, 259 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(117 - 1, 260 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(116 - 1, 261 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(115 - 1, 262 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(114 - 1, 263 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(57 - 1, 270 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(56 - 1, 271 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(55 - 1, 272 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(54 - 1, 273 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(53 - 1, 274 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(52 - 1, 275 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(51 - 1, 276 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(50 - 1, 277 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(49 - 1, 278 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(48 - 1, 280 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(47 - 1, 281 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(46 - 1, 282 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(15 - 1, 285 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(14 - 1, 286 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(13 - 1, 287 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(12 - 1, 288 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(11 - 1, 289 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(2 - 1, 290 - 1, c[27]));  
-	triplets.push_back(Triplet< double >(245 - 1, 1 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(244 - 1, 4 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(243 - 1, 7 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(242 - 1, 9 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(241 - 1, 12 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(240 - 1, 13 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(239 - 1, 16 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(238 - 1, 21 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(237 - 1, 22 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(236 - 1, 23 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(235 - 1, 24 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(234 - 1, 27 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(233 - 1, 28 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(232 - 1, 29 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(231 - 1, 32 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(230 - 1, 33 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(229 - 1, 36 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(156 - 1, 56 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(155 - 1, 57 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(154 - 1, 58 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(153 - 1, 59 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(152 - 1, 62 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(151 - 1, 63 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(150 - 1, 64 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(149 - 1, 67 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(148 - 1, 68 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(147 - 1, 71 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(146 - 1, 77 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(145 - 1, 79 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(144 - 1, 82 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(143 - 1, 83 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(142 - 1, 86 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(141 - 1, 107 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(140 - 1, 108 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(139 - 1, 109 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(138 - 1, 112 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(137 - 1, 113 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(136 - 1, 116 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(69 - 1, 138 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(68 - 1, 139 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(67 - 1, 140 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(66 - 1, 143 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(65 - 1, 144 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(64 - 1, 147 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(63 - 1, 153 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(62 - 1, 154 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(61 - 1, 157 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(60 - 1, 176 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(59 - 1, 177 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(58 - 1, 180 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(20 - 1, 202 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(19 - 1, 203 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(18 - 1, 206 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(17 - 1, 212 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(16 - 1, 228 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(3 - 1, 250 - 1, c[28]));  
-	triplets.push_back(Triplet< double >(245 - 1, 2 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(244 - 1, 5 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(243 - 1, 8 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(242 - 1, 10 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(241 - 1, 13 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(240 - 1, 14 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(239 - 1, 17 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(238 - 1, 22 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(237 - 1, 23 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(236 - 1, 24 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(235 - 1, 25 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(234 - 1, 28 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(233 - 1, 29 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(232 - 1, 30 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(231 - 1, 33 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(230 - 1, 34 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(229 - 1, 37 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(156 - 1, 57 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(155 - 1, 58 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(154 - 1, 59 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(153 - 1, 60 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(152 - 1, 63 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(151 - 1, 64 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(150 - 1, 65 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(149 - 1, 68 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(148 - 1, 69 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(147 - 1, 72 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(146 - 1, 78 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(145 - 1, 80 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(144 - 1, 83 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(143 - 1, 84 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(142 - 1, 87 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(141 - 1, 108 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(140 - 1, 109 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(139 - 1, 110 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(138 - 1, 113 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(137 - 1, 114 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(136 - 1, 117 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(69 - 1, 139 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(68 - 1, 140 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(67 - 1, 141 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(66 - 1, 144 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(65 - 1, 145 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(64 - 1, 148 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(63 - 1, 154 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(62 - 1, 155 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(61 - 1, 158 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(60 - 1, 177 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(59 - 1, 178 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(58 - 1, 181 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(20 - 1, 203 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(19 - 1, 204 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(18 - 1, 207 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(17 - 1, 213 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(16 - 1, 229 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(3 - 1, 251 - 1, c[29]));  
-	triplets.push_back(Triplet< double >(245 - 1, 6 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(244 - 1, 9 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(243 - 1, 11 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(242 - 1, 13 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(241 - 1, 15 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(240 - 1, 16 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(239 - 1, 18 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(238 - 1, 26 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(237 - 1, 27 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(236 - 1, 28 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(235 - 1, 29 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(234 - 1, 31 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(233 - 1, 32 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(232 - 1, 33 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(231 - 1, 35 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(230 - 1, 36 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(229 - 1, 38 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(156 - 1, 61 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(155 - 1, 62 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(154 - 1, 63 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(153 - 1, 64 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(152 - 1, 66 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(151 - 1, 67 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(150 - 1, 68 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(149 - 1, 70 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(148 - 1, 71 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(147 - 1, 73 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(146 - 1, 81 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(145 - 1, 83 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(144 - 1, 85 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(143 - 1, 86 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(142 - 1, 88 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(141 - 1, 111 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(140 - 1, 112 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(139 - 1, 113 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(138 - 1, 115 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(137 - 1, 116 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(136 - 1, 118 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(69 - 1, 142 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(68 - 1, 143 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(67 - 1, 144 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(66 - 1, 146 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(65 - 1, 147 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(64 - 1, 149 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(63 - 1, 156 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(62 - 1, 157 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(61 - 1, 159 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(60 - 1, 179 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(59 - 1, 180 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(58 - 1, 182 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(20 - 1, 205 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(19 - 1, 206 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(18 - 1, 208 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(17 - 1, 214 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(16 - 1, 230 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(3 - 1, 252 - 1, c[30]));  
-	triplets.push_back(Triplet< double >(245 - 1, 7 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(244 - 1, 10 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(243 - 1, 12 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(242 - 1, 14 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(241 - 1, 16 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(240 - 1, 17 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(239 - 1, 19 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(238 - 1, 27 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(237 - 1, 28 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(236 - 1, 29 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(235 - 1, 30 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(234 - 1, 32 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(233 - 1, 33 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(232 - 1, 34 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(231 - 1, 36 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(230 - 1, 37 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(229 - 1, 39 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(156 - 1, 62 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(155 - 1, 63 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(154 - 1, 64 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(153 - 1, 65 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(152 - 1, 67 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(151 - 1, 68 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(150 - 1, 69 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(149 - 1, 71 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(148 - 1, 72 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(147 - 1, 74 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(146 - 1, 82 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(145 - 1, 84 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(144 - 1, 86 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(143 - 1, 87 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(142 - 1, 89 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(141 - 1, 112 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(140 - 1, 113 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(139 - 1, 114 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(138 - 1, 116 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(137 - 1, 117 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(136 - 1, 119 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(69 - 1, 143 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(68 - 1, 144 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(67 - 1, 145 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(66 - 1, 147 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(65 - 1, 148 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(64 - 1, 150 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(63 - 1, 157 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(62 - 1, 158 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(61 - 1, 160 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(60 - 1, 180 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(59 - 1, 181 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(58 - 1, 183 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(20 - 1, 206 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(19 - 1, 207 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(18 - 1, 209 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(17 - 1, 215 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(16 - 1, 231 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(3 - 1, 253 - 1, c[31]));  
-	triplets.push_back(Triplet< double >(245 - 1, 11 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(244 - 1, 14 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(243 - 1, 15 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(242 - 1, 17 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(241 - 1, 18 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(240 - 1, 19 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(239 - 1, 20 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(238 - 1, 31 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(237 - 1, 32 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(236 - 1, 33 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(235 - 1, 34 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(234 - 1, 35 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(233 - 1, 36 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(232 - 1, 37 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(231 - 1, 38 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(230 - 1, 39 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(229 - 1, 40 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(156 - 1, 66 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(155 - 1, 67 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(154 - 1, 68 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(153 - 1, 69 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(152 - 1, 70 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(151 - 1, 71 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(150 - 1, 72 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(149 - 1, 73 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(148 - 1, 74 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(147 - 1, 75 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(146 - 1, 85 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(145 - 1, 87 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(144 - 1, 88 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(143 - 1, 89 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(142 - 1, 90 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(141 - 1, 115 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(140 - 1, 116 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(139 - 1, 117 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(138 - 1, 118 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(137 - 1, 119 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(136 - 1, 120 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(69 - 1, 146 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(68 - 1, 147 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(67 - 1, 148 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(66 - 1, 149 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(65 - 1, 150 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(64 - 1, 151 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(63 - 1, 159 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(62 - 1, 160 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(61 - 1, 161 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(60 - 1, 182 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(59 - 1, 183 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(58 - 1, 184 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(20 - 1, 208 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(19 - 1, 209 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(18 - 1, 210 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(17 - 1, 216 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(16 - 1, 232 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(3 - 1, 254 - 1, c[32]));  
-	triplets.push_back(Triplet< double >(244 - 1, 23 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(243 - 1, 26 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(242 - 1, 28 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(241 - 1, 31 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(240 - 1, 32 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(239 - 1, 35 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(234 - 1, 41 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(233 - 1, 42 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(232 - 1, 43 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(231 - 1, 46 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(230 - 1, 47 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(229 - 1, 50 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(152 - 1, 91 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(151 - 1, 92 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(150 - 1, 93 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(149 - 1, 96 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(148 - 1, 97 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(147 - 1, 100 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(146 - 1, 106 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(145 - 1, 108 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(144 - 1, 111 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(143 - 1, 112 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(142 - 1, 115 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(141 - 1, 121 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(140 - 1, 122 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(139 - 1, 123 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(138 - 1, 124 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(137 - 1, 125 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(136 - 1, 128 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(69 - 1, 162 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(68 - 1, 163 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(67 - 1, 164 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(66 - 1, 165 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(65 - 1, 166 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(64 - 1, 169 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(63 - 1, 175 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(62 - 1, 176 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(61 - 1, 179 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(60 - 1, 185 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(59 - 1, 186 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(58 - 1, 189 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(20 - 1, 217 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(19 - 1, 218 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(18 - 1, 221 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(17 - 1, 227 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(16 - 1, 233 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(3 - 1, 258 - 1, c[33]));  
-	triplets.push_back(Triplet< double >(245 - 1, 21 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(244 - 1, 24 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(243 - 1, 27 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(242 - 1, 29 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(241 - 1, 32 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(240 - 1, 33 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(239 - 1, 36 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(234 - 1, 42 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(233 - 1, 43 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(232 - 1, 44 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(231 - 1, 47 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(230 - 1, 48 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(229 - 1, 51 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(152 - 1, 92 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(151 - 1, 93 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(150 - 1, 94 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(149 - 1, 97 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(148 - 1, 98 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(147 - 1, 101 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(146 - 1, 107 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(145 - 1, 109 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(144 - 1, 112 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(143 - 1, 113 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(142 - 1, 116 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(141 - 1, 122 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(140 - 1, 123 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(138 - 1, 125 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(137 - 1, 126 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(136 - 1, 129 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(69 - 1, 163 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(68 - 1, 164 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(66 - 1, 166 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(65 - 1, 167 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(64 - 1, 170 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(63 - 1, 176 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(62 - 1, 177 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(61 - 1, 180 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(60 - 1, 186 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(59 - 1, 187 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(58 - 1, 190 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(20 - 1, 218 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(19 - 1, 219 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(18 - 1, 222 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(17 - 1, 228 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(16 - 1, 234 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(3 - 1, 259 - 1, c[34]));  
-	triplets.push_back(Triplet< double >(245 - 1, 26 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(244 - 1, 29 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(243 - 1, 31 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(242 - 1, 33 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(241 - 1, 35 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(240 - 1, 36 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(239 - 1, 38 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(238 - 1, 41 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(237 - 1, 42 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(236 - 1, 43 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(235 - 1, 44 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(234 - 1, 46 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(233 - 1, 47 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(232 - 1, 48 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(231 - 1, 50 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(230 - 1, 51 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(229 - 1, 53 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(156 - 1, 91 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(155 - 1, 92 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(154 - 1, 93 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(153 - 1, 94 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(152 - 1, 96 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(151 - 1, 97 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(150 - 1, 98 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(149 - 1, 100 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(148 - 1, 101 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(147 - 1, 103 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(146 - 1, 111 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(145 - 1, 113 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(144 - 1, 115 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(143 - 1, 116 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(142 - 1, 118 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(141 - 1, 124 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(140 - 1, 125 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(139 - 1, 126 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(138 - 1, 128 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(137 - 1, 129 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(136 - 1, 131 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(69 - 1, 165 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(68 - 1, 166 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(67 - 1, 167 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(66 - 1, 169 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(65 - 1, 170 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(64 - 1, 172 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(63 - 1, 179 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(62 - 1, 180 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(61 - 1, 182 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(60 - 1, 189 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(59 - 1, 190 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(58 - 1, 192 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(20 - 1, 221 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(19 - 1, 222 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(18 - 1, 224 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(17 - 1, 230 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(16 - 1, 236 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(3 - 1, 261 - 1, c[35]));  
-	triplets.push_back(Triplet< double >(245 - 1, 27 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(244 - 1, 30 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(243 - 1, 32 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(242 - 1, 34 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(241 - 1, 36 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(240 - 1, 37 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(239 - 1, 39 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(238 - 1, 42 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(237 - 1, 43 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(236 - 1, 44 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(235 - 1, 45 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(234 - 1, 47 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(233 - 1, 48 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(232 - 1, 49 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(231 - 1, 51 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(230 - 1, 52 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(229 - 1, 54 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(156 - 1, 92 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(155 - 1, 93 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(154 - 1, 94 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(153 - 1, 95 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(152 - 1, 97 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(151 - 1, 98 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(150 - 1, 99 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(149 - 1, 101 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(148 - 1, 102 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(147 - 1, 104 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(146 - 1, 112 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(145 - 1, 114 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(144 - 1, 116 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(143 - 1, 117 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(142 - 1, 119 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(141 - 1, 125 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(140 - 1, 126 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(139 - 1, 127 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(138 - 1, 129 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(137 - 1, 130 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(136 - 1, 132 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(69 - 1, 166 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(68 - 1, 167 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(67 - 1, 168 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(66 - 1, 170 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(65 - 1, 171 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(64 - 1, 173 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(63 - 1, 180 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(62 - 1, 181 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(61 - 1, 183 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(60 - 1, 190 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(59 - 1, 191 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(58 - 1, 193 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(20 - 1, 222 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(19 - 1, 223 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(18 - 1, 225 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(17 - 1, 231 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(16 - 1, 237 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(3 - 1, 262 - 1, c[36]));  
-	triplets.push_back(Triplet< double >(245 - 1, 31 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(244 - 1, 34 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(243 - 1, 35 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(242 - 1, 37 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(241 - 1, 38 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(240 - 1, 39 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(239 - 1, 40 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(238 - 1, 46 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(237 - 1, 47 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(236 - 1, 48 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(235 - 1, 49 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(234 - 1, 50 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(233 - 1, 51 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(232 - 1, 52 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(231 - 1, 53 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(230 - 1, 54 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(229 - 1, 55 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(156 - 1, 96 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(155 - 1, 97 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(154 - 1, 98 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(153 - 1, 99 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(152 - 1, 100 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(151 - 1, 101 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(150 - 1, 102 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(149 - 1, 103 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(148 - 1, 104 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(147 - 1, 105 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(146 - 1, 115 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(145 - 1, 117 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(144 - 1, 118 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(143 - 1, 119 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(142 - 1, 120 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(141 - 1, 128 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(140 - 1, 129 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(139 - 1, 130 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(138 - 1, 131 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(137 - 1, 132 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(136 - 1, 133 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(69 - 1, 169 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(68 - 1, 170 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(67 - 1, 171 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(66 - 1, 172 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(65 - 1, 173 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(64 - 1, 174 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(63 - 1, 182 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(62 - 1, 183 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(61 - 1, 184 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(60 - 1, 192 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(59 - 1, 193 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(58 - 1, 194 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(20 - 1, 224 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(19 - 1, 225 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(18 - 1, 226 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(17 - 1, 232 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(16 - 1, 238 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(3 - 1, 263 - 1, c[37]));  
-	triplets.push_back(Triplet< double >(244 - 1, 58 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(243 - 1, 61 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(242 - 1, 63 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(241 - 1, 66 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(240 - 1, 67 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(239 - 1, 70 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(234 - 1, 91 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(233 - 1, 92 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(232 - 1, 93 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(231 - 1, 96 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(230 - 1, 97 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(229 - 1, 100 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(151 - 1, 134 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(150 - 1, 135 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(148 - 1, 136 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(146 - 1, 137 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(145 - 1, 139 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(144 - 1, 142 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(143 - 1, 143 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(142 - 1, 146 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(141 - 1, 162 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(140 - 1, 163 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(139 - 1, 164 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(138 - 1, 165 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(137 - 1, 166 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(136 - 1, 169 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(69 - 1, 195 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(68 - 1, 196 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(67 - 1, 197 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(66 - 1, 198 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(65 - 1, 199 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(64 - 1, 200 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(63 - 1, 201 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(62 - 1, 202 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(61 - 1, 205 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(60 - 1, 217 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(59 - 1, 218 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(58 - 1, 221 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(20 - 1, 239 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(19 - 1, 240 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(18 - 1, 243 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(17 - 1, 249 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(16 - 1, 258 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(3 - 1, 270 - 1, c[38]));  
-	triplets.push_back(Triplet< double >(245 - 1, 56 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(244 - 1, 59 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(243 - 1, 62 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(242 - 1, 64 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(241 - 1, 67 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(240 - 1, 68 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(239 - 1, 71 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(234 - 1, 92 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(233 - 1, 93 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(232 - 1, 94 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(231 - 1, 97 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(230 - 1, 98 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(229 - 1, 101 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(152 - 1, 134 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(151 - 1, 135 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(149 - 1, 136 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(146 - 1, 138 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(145 - 1, 140 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(144 - 1, 143 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(143 - 1, 144 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(142 - 1, 147 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(141 - 1, 163 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(140 - 1, 164 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(138 - 1, 166 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(137 - 1, 167 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(136 - 1, 170 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(69 - 1, 196 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(68 - 1, 197 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(66 - 1, 199 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(63 - 1, 202 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(62 - 1, 203 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(61 - 1, 206 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(60 - 1, 218 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(59 - 1, 219 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(58 - 1, 222 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(20 - 1, 240 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(19 - 1, 241 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(18 - 1, 244 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(17 - 1, 250 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(16 - 1, 259 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(3 - 1, 271 - 1, c[39]));  
-	triplets.push_back(Triplet< double >(245 - 1, 57 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(244 - 1, 60 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(243 - 1, 63 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(242 - 1, 65 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(241 - 1, 68 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(240 - 1, 69 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(239 - 1, 72 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(234 - 1, 93 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(233 - 1, 94 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(232 - 1, 95 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(231 - 1, 98 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(230 - 1, 99 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(229 - 1, 102 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(152 - 1, 135 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(146 - 1, 139 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(145 - 1, 141 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(144 - 1, 144 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(143 - 1, 145 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(142 - 1, 148 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(141 - 1, 164 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(138 - 1, 167 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(137 - 1, 168 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(136 - 1, 171 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(69 - 1, 197 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(63 - 1, 203 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(62 - 1, 204 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(61 - 1, 207 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(60 - 1, 219 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(59 - 1, 220 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(58 - 1, 223 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(20 - 1, 241 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(19 - 1, 242 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(18 - 1, 245 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(17 - 1, 251 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(16 - 1, 260 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(3 - 1, 272 - 1, c[40]));  
-	triplets.push_back(Triplet< double >(245 - 1, 61 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(244 - 1, 64 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(243 - 1, 66 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(242 - 1, 68 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(241 - 1, 70 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(240 - 1, 71 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(239 - 1, 73 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(238 - 1, 91 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(237 - 1, 92 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(236 - 1, 93 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(235 - 1, 94 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(234 - 1, 96 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(233 - 1, 97 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(232 - 1, 98 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(231 - 1, 100 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(230 - 1, 101 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(229 - 1, 103 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(155 - 1, 134 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(154 - 1, 135 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(151 - 1, 136 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(146 - 1, 142 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(145 - 1, 144 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(144 - 1, 146 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(143 - 1, 147 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(142 - 1, 149 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(141 - 1, 165 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(140 - 1, 166 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(139 - 1, 167 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(138 - 1, 169 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(137 - 1, 170 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(136 - 1, 172 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(69 - 1, 198 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(68 - 1, 199 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(66 - 1, 200 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(63 - 1, 205 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(62 - 1, 206 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(61 - 1, 208 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(60 - 1, 221 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(59 - 1, 222 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(58 - 1, 224 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(20 - 1, 243 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(19 - 1, 244 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(18 - 1, 246 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(17 - 1, 252 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(16 - 1, 261 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(3 - 1, 273 - 1, c[41]));  
-	triplets.push_back(Triplet< double >(245 - 1, 62 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(244 - 1, 65 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(243 - 1, 67 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(242 - 1, 69 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(241 - 1, 71 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(240 - 1, 72 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(239 - 1, 74 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(238 - 1, 92 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(237 - 1, 93 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(236 - 1, 94 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(235 - 1, 95 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(234 - 1, 97 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(233 - 1, 98 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(232 - 1, 99 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(231 - 1, 101 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(230 - 1, 102 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(229 - 1, 104 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(156 - 1, 134 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(155 - 1, 135 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(152 - 1, 136 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(146 - 1, 143 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(145 - 1, 145 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(144 - 1, 147 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(143 - 1, 148 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(142 - 1, 150 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(141 - 1, 166 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(140 - 1, 167 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(139 - 1, 168 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(138 - 1, 170 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(137 - 1, 171 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(136 - 1, 173 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(69 - 1, 199 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(63 - 1, 206 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(62 - 1, 207 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(61 - 1, 209 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(60 - 1, 222 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(59 - 1, 223 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(58 - 1, 225 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(20 - 1, 244 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(19 - 1, 245 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(18 - 1, 247 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(17 - 1, 253 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(16 - 1, 262 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(3 - 1, 274 - 1, c[42]));  
-	triplets.push_back(Triplet< double >(245 - 1, 76 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(244 - 1, 79 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(243 - 1, 81 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(242 - 1, 83 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(241 - 1, 85 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(240 - 1, 86 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(239 - 1, 88 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(238 - 1, 106 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(237 - 1, 107 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(236 - 1, 108 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(235 - 1, 109 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(234 - 1, 111 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(233 - 1, 112 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(232 - 1, 113 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(231 - 1, 115 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(230 - 1, 116 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(229 - 1, 118 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(156 - 1, 137 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(155 - 1, 138 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(154 - 1, 139 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(153 - 1, 140 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(152 - 1, 142 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(151 - 1, 143 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(150 - 1, 144 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(149 - 1, 146 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(148 - 1, 147 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(147 - 1, 149 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(146 - 1, 152 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(145 - 1, 154 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(144 - 1, 156 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(143 - 1, 157 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(142 - 1, 159 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(141 - 1, 175 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(140 - 1, 176 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(139 - 1, 177 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(138 - 1, 179 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(137 - 1, 180 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(136 - 1, 182 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(69 - 1, 201 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(68 - 1, 202 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(67 - 1, 203 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(66 - 1, 205 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(65 - 1, 206 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(64 - 1, 208 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(63 - 1, 211 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(62 - 1, 212 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(61 - 1, 214 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(60 - 1, 227 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(59 - 1, 228 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(58 - 1, 230 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(20 - 1, 249 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(19 - 1, 250 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(18 - 1, 252 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(17 - 1, 255 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(16 - 1, 264 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(3 - 1, 276 - 1, c[43]));  
-	triplets.push_back(Triplet< double >(245 - 1, 77 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(244 - 1, 80 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(243 - 1, 82 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(242 - 1, 84 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(241 - 1, 86 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(240 - 1, 87 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(239 - 1, 89 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(238 - 1, 107 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(237 - 1, 108 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(236 - 1, 109 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(235 - 1, 110 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(234 - 1, 112 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(233 - 1, 113 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(232 - 1, 114 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(231 - 1, 116 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(230 - 1, 117 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(229 - 1, 119 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(156 - 1, 138 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(155 - 1, 139 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(154 - 1, 140 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(153 - 1, 141 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(152 - 1, 143 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(151 - 1, 144 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(150 - 1, 145 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(149 - 1, 147 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(148 - 1, 148 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(147 - 1, 150 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(146 - 1, 153 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(145 - 1, 155 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(144 - 1, 157 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(143 - 1, 158 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(142 - 1, 160 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(141 - 1, 176 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(140 - 1, 177 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(139 - 1, 178 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(138 - 1, 180 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(137 - 1, 181 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(136 - 1, 183 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(69 - 1, 202 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(68 - 1, 203 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(67 - 1, 204 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(66 - 1, 206 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(65 - 1, 207 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(64 - 1, 209 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(63 - 1, 212 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(62 - 1, 213 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(61 - 1, 215 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(60 - 1, 228 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(59 - 1, 229 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(58 - 1, 231 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(20 - 1, 250 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(19 - 1, 251 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(18 - 1, 253 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(17 - 1, 256 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(16 - 1, 265 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(3 - 1, 277 - 1, c[44]));  
-	triplets.push_back(Triplet< double >(245 - 1, 81 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(244 - 1, 84 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(243 - 1, 85 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(242 - 1, 87 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(241 - 1, 88 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(240 - 1, 89 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(239 - 1, 90 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(238 - 1, 111 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(237 - 1, 112 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(236 - 1, 113 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(235 - 1, 114 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(234 - 1, 115 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(233 - 1, 116 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(232 - 1, 117 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(231 - 1, 118 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(230 - 1, 119 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(229 - 1, 120 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(156 - 1, 142 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(155 - 1, 143 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(154 - 1, 144 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(153 - 1, 145 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(152 - 1, 146 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(151 - 1, 147 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(150 - 1, 148 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(149 - 1, 149 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(148 - 1, 150 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(147 - 1, 151 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(146 - 1, 156 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(145 - 1, 158 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(144 - 1, 159 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(143 - 1, 160 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(142 - 1, 161 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(141 - 1, 179 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(140 - 1, 180 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(139 - 1, 181 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(138 - 1, 182 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(137 - 1, 183 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(136 - 1, 184 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(69 - 1, 205 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(68 - 1, 206 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(67 - 1, 207 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(66 - 1, 208 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(65 - 1, 209 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(64 - 1, 210 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(63 - 1, 214 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(62 - 1, 215 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(61 - 1, 216 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(60 - 1, 230 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(59 - 1, 231 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(58 - 1, 232 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(20 - 1, 252 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(19 - 1, 253 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(18 - 1, 254 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(17 - 1, 257 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(16 - 1, 266 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(3 - 1, 278 - 1, c[45]));  
-	triplets.push_back(Triplet< double >(245 - 1, 106 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(244 - 1, 109 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(243 - 1, 111 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(242 - 1, 113 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(241 - 1, 115 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(240 - 1, 116 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(239 - 1, 118 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(238 - 1, 121 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(237 - 1, 122 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(236 - 1, 123 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(234 - 1, 124 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(233 - 1, 125 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(232 - 1, 126 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(231 - 1, 128 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(230 - 1, 129 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(229 - 1, 131 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(156 - 1, 162 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(155 - 1, 163 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(154 - 1, 164 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(152 - 1, 165 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(151 - 1, 166 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(150 - 1, 167 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(149 - 1, 169 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(148 - 1, 170 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(147 - 1, 172 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(146 - 1, 175 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(145 - 1, 177 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(144 - 1, 179 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(143 - 1, 180 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(142 - 1, 182 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(141 - 1, 185 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(140 - 1, 186 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(139 - 1, 187 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(138 - 1, 189 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(137 - 1, 190 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(136 - 1, 192 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(69 - 1, 217 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(68 - 1, 218 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(67 - 1, 219 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(66 - 1, 221 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(65 - 1, 222 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(64 - 1, 224 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(63 - 1, 227 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(62 - 1, 228 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(61 - 1, 230 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(60 - 1, 233 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(59 - 1, 234 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(58 - 1, 236 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(20 - 1, 258 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(19 - 1, 259 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(18 - 1, 261 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(17 - 1, 264 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(16 - 1, 267 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(3 - 1, 280 - 1, c[46]));  
-	triplets.push_back(Triplet< double >(245 - 1, 107 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(244 - 1, 110 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(243 - 1, 112 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(242 - 1, 114 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(241 - 1, 116 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(240 - 1, 117 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(239 - 1, 119 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(238 - 1, 122 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(237 - 1, 123 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(234 - 1, 125 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(233 - 1, 126 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(232 - 1, 127 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(231 - 1, 129 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(230 - 1, 130 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(229 - 1, 132 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(156 - 1, 163 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(155 - 1, 164 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(152 - 1, 166 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(151 - 1, 167 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(150 - 1, 168 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(149 - 1, 170 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(148 - 1, 171 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(147 - 1, 173 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(146 - 1, 176 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(145 - 1, 178 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(144 - 1, 180 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(143 - 1, 181 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(142 - 1, 183 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(141 - 1, 186 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(140 - 1, 187 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(139 - 1, 188 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(138 - 1, 190 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(137 - 1, 191 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(136 - 1, 193 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(69 - 1, 218 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(68 - 1, 219 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(67 - 1, 220 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(66 - 1, 222 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(65 - 1, 223 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(64 - 1, 225 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(63 - 1, 228 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(62 - 1, 229 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(61 - 1, 231 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(60 - 1, 234 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(59 - 1, 235 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(58 - 1, 237 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(20 - 1, 259 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(19 - 1, 260 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(18 - 1, 262 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(17 - 1, 265 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(16 - 1, 268 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(3 - 1, 281 - 1, c[47]));  
-	triplets.push_back(Triplet< double >(245 - 1, 111 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(244 - 1, 114 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(243 - 1, 115 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(242 - 1, 117 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(241 - 1, 118 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(240 - 1, 119 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(239 - 1, 120 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(238 - 1, 124 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(237 - 1, 125 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(236 - 1, 126 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(235 - 1, 127 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(234 - 1, 128 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(233 - 1, 129 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(232 - 1, 130 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(231 - 1, 131 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(230 - 1, 132 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(229 - 1, 133 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(156 - 1, 165 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(155 - 1, 166 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(154 - 1, 167 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(153 - 1, 168 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(152 - 1, 169 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(151 - 1, 170 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(150 - 1, 171 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(149 - 1, 172 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(148 - 1, 173 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(147 - 1, 174 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(146 - 1, 179 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(145 - 1, 181 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(144 - 1, 182 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(143 - 1, 183 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(142 - 1, 184 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(141 - 1, 189 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(140 - 1, 190 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(139 - 1, 191 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(138 - 1, 192 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(137 - 1, 193 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(136 - 1, 194 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(69 - 1, 221 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(68 - 1, 222 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(67 - 1, 223 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(66 - 1, 224 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(65 - 1, 225 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(64 - 1, 226 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(63 - 1, 230 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(62 - 1, 231 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(61 - 1, 232 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(60 - 1, 236 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(59 - 1, 237 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(58 - 1, 238 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(20 - 1, 261 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(19 - 1, 262 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(18 - 1, 263 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(17 - 1, 266 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(16 - 1, 269 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(3 - 1, 282 - 1, c[48]));  
-	triplets.push_back(Triplet< double >(245 - 1, 137 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(244 - 1, 140 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(243 - 1, 142 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(242 - 1, 144 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(241 - 1, 146 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(240 - 1, 147 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(239 - 1, 149 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(238 - 1, 162 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(237 - 1, 163 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(236 - 1, 164 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(234 - 1, 165 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(233 - 1, 166 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(232 - 1, 167 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(231 - 1, 169 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(230 - 1, 170 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(229 - 1, 172 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(156 - 1, 195 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(155 - 1, 196 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(154 - 1, 197 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(152 - 1, 198 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(151 - 1, 199 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(149 - 1, 200 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(146 - 1, 201 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(145 - 1, 203 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(144 - 1, 205 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(143 - 1, 206 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(142 - 1, 208 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(141 - 1, 217 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(140 - 1, 218 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(139 - 1, 219 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(138 - 1, 221 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(137 - 1, 222 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(136 - 1, 224 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(69 - 1, 239 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(68 - 1, 240 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(67 - 1, 241 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(66 - 1, 243 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(65 - 1, 244 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(64 - 1, 246 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(63 - 1, 249 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(62 - 1, 250 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(61 - 1, 252 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(60 - 1, 258 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(59 - 1, 259 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(58 - 1, 261 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(20 - 1, 270 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(19 - 1, 271 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(18 - 1, 273 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(17 - 1, 276 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(16 - 1, 280 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(3 - 1, 285 - 1, c[49]));  
-	triplets.push_back(Triplet< double >(245 - 1, 138 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(244 - 1, 141 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(243 - 1, 143 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(242 - 1, 145 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(241 - 1, 147 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(240 - 1, 148 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(239 - 1, 150 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(238 - 1, 163 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(237 - 1, 164 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(234 - 1, 166 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(233 - 1, 167 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(232 - 1, 168 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(231 - 1, 170 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(230 - 1, 171 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(229 - 1, 173 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(156 - 1, 196 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(155 - 1, 197 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(152 - 1, 199 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(146 - 1, 202 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(145 - 1, 204 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(144 - 1, 206 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(143 - 1, 207 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(142 - 1, 209 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(141 - 1, 218 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(140 - 1, 219 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(139 - 1, 220 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(138 - 1, 222 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(137 - 1, 223 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(136 - 1, 225 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(69 - 1, 240 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(68 - 1, 241 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(67 - 1, 242 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(66 - 1, 244 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(65 - 1, 245 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(64 - 1, 247 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(63 - 1, 250 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(62 - 1, 251 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(61 - 1, 253 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(60 - 1, 259 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(59 - 1, 260 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(58 - 1, 262 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(20 - 1, 271 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(19 - 1, 272 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(18 - 1, 274 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(17 - 1, 277 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(16 - 1, 281 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(3 - 1, 286 - 1, c[50]));  
-	triplets.push_back(Triplet< double >(245 - 1, 142 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(244 - 1, 145 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(243 - 1, 146 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(242 - 1, 148 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(241 - 1, 149 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(240 - 1, 150 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(239 - 1, 151 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(238 - 1, 165 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(237 - 1, 166 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(236 - 1, 167 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(235 - 1, 168 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(234 - 1, 169 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(233 - 1, 170 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(232 - 1, 171 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(231 - 1, 172 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(230 - 1, 173 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(229 - 1, 174 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(156 - 1, 198 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(155 - 1, 199 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(152 - 1, 200 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(146 - 1, 205 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(145 - 1, 207 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(144 - 1, 208 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(143 - 1, 209 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(142 - 1, 210 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(141 - 1, 221 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(140 - 1, 222 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(139 - 1, 223 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(138 - 1, 224 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(137 - 1, 225 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(136 - 1, 226 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(69 - 1, 243 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(68 - 1, 244 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(67 - 1, 245 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(66 - 1, 246 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(65 - 1, 247 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(64 - 1, 248 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(63 - 1, 252 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(62 - 1, 253 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(61 - 1, 254 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(60 - 1, 261 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(59 - 1, 262 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(58 - 1, 263 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(20 - 1, 273 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(19 - 1, 274 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(18 - 1, 275 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(17 - 1, 278 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(16 - 1, 282 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(3 - 1, 287 - 1, c[51]));  
-	triplets.push_back(Triplet< double >(245 - 1, 152 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(244 - 1, 155 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(243 - 1, 156 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(242 - 1, 158 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(241 - 1, 159 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(240 - 1, 160 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(239 - 1, 161 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(238 - 1, 175 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(237 - 1, 176 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(236 - 1, 177 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(235 - 1, 178 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(234 - 1, 179 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(233 - 1, 180 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(232 - 1, 181 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(231 - 1, 182 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(230 - 1, 183 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(229 - 1, 184 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(156 - 1, 201 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(155 - 1, 202 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(154 - 1, 203 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(153 - 1, 204 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(152 - 1, 205 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(151 - 1, 206 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(150 - 1, 207 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(149 - 1, 208 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(148 - 1, 209 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(147 - 1, 210 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(146 - 1, 211 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(145 - 1, 213 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(144 - 1, 214 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(143 - 1, 215 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(142 - 1, 216 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(141 - 1, 227 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(140 - 1, 228 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(139 - 1, 229 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(138 - 1, 230 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(137 - 1, 231 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(136 - 1, 232 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(69 - 1, 249 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(68 - 1, 250 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(67 - 1, 251 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(66 - 1, 252 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(65 - 1, 253 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(64 - 1, 254 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(63 - 1, 255 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(62 - 1, 256 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(61 - 1, 257 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(60 - 1, 264 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(59 - 1, 265 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(58 - 1, 266 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(20 - 1, 276 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(19 - 1, 277 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(18 - 1, 278 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(17 - 1, 279 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(16 - 1, 283 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(3 - 1, 288 - 1, c[52]));  
-	triplets.push_back(Triplet< double >(245 - 1, 175 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(244 - 1, 178 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(243 - 1, 179 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(242 - 1, 181 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(241 - 1, 182 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(240 - 1, 183 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(239 - 1, 184 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(238 - 1, 185 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(237 - 1, 186 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(236 - 1, 187 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(235 - 1, 188 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(234 - 1, 189 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(233 - 1, 190 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(232 - 1, 191 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(231 - 1, 192 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(230 - 1, 193 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(229 - 1, 194 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(156 - 1, 217 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(155 - 1, 218 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(154 - 1, 219 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(153 - 1, 220 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(152 - 1, 221 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(151 - 1, 222 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(150 - 1, 223 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(149 - 1, 224 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(148 - 1, 225 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(147 - 1, 226 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(146 - 1, 227 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(145 - 1, 229 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(144 - 1, 230 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(143 - 1, 231 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(142 - 1, 232 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(141 - 1, 233 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(140 - 1, 234 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(139 - 1, 235 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(138 - 1, 236 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(137 - 1, 237 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(136 - 1, 238 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(69 - 1, 258 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(68 - 1, 259 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(67 - 1, 260 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(66 - 1, 261 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(65 - 1, 262 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(64 - 1, 263 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(63 - 1, 264 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(62 - 1, 265 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(61 - 1, 266 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(60 - 1, 267 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(59 - 1, 268 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(58 - 1, 269 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(20 - 1, 280 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(19 - 1, 281 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(18 - 1, 282 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(17 - 1, 283 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(16 - 1, 284 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(3 - 1, 289 - 1, c[53]));  
-	triplets.push_back(Triplet< double >(245 - 1, 201 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(244 - 1, 204 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(243 - 1, 205 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(242 - 1, 207 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(241 - 1, 208 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(240 - 1, 209 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(239 - 1, 210 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(238 - 1, 217 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(237 - 1, 218 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(236 - 1, 219 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(235 - 1, 220 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(234 - 1, 221 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(233 - 1, 222 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(232 - 1, 223 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(231 - 1, 224 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(230 - 1, 225 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(229 - 1, 226 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(156 - 1, 239 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(155 - 1, 240 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(154 - 1, 241 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(153 - 1, 242 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(152 - 1, 243 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(151 - 1, 244 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(150 - 1, 245 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(149 - 1, 246 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(148 - 1, 247 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(147 - 1, 248 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(146 - 1, 249 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(145 - 1, 251 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(144 - 1, 252 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(143 - 1, 253 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(142 - 1, 254 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(141 - 1, 258 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(140 - 1, 259 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(139 - 1, 260 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(138 - 1, 261 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(137 - 1, 262 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(136 - 1, 263 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(69 - 1, 270 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(68 - 1, 271 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(67 - 1, 272 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(66 - 1, 273 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(65 - 1, 274 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(64 - 1, 275 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(63 - 1, 276 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(62 - 1, 277 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(61 - 1, 278 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(60 - 1, 280 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(59 - 1, 281 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(58 - 1, 282 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(20 - 1, 285 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(19 - 1, 286 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(18 - 1, 287 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(17 - 1, 288 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(16 - 1, 289 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(3 - 1, 290 - 1, c[54]));  
-	triplets.push_back(Triplet< double >(259 - 1, 1 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(258 - 1, 12 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(257 - 1, 13 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(256 - 1, 16 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(255 - 1, 21 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(254 - 1, 22 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(253 - 1, 23 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(252 - 1, 24 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(251 - 1, 27 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(250 - 1, 28 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(249 - 1, 29 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(248 - 1, 32 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(247 - 1, 33 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(246 - 1, 36 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(176 - 1, 56 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(175 - 1, 57 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(174 - 1, 58 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(173 - 1, 59 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(172 - 1, 62 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(171 - 1, 63 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(170 - 1, 64 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(169 - 1, 67 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(168 - 1, 68 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(167 - 1, 71 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(166 - 1, 77 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(165 - 1, 82 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(164 - 1, 83 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(163 - 1, 86 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(162 - 1, 107 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(161 - 1, 108 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(160 - 1, 109 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(159 - 1, 112 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(158 - 1, 113 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(157 - 1, 116 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(81 - 1, 138 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(80 - 1, 139 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(79 - 1, 140 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(78 - 1, 143 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(77 - 1, 144 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(76 - 1, 147 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(75 - 1, 153 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(74 - 1, 154 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(73 - 1, 157 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(72 - 1, 176 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(71 - 1, 177 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(70 - 1, 180 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(25 - 1, 202 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(24 - 1, 203 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(23 - 1, 206 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(22 - 1, 212 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(21 - 1, 228 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(4 - 1, 250 - 1, c[55]));  
-	triplets.push_back(Triplet< double >(259 - 1, 2 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(258 - 1, 13 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(257 - 1, 14 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(256 - 1, 17 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(255 - 1, 22 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(254 - 1, 23 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(253 - 1, 24 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(252 - 1, 25 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(251 - 1, 28 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(250 - 1, 29 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(249 - 1, 30 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(248 - 1, 33 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(247 - 1, 34 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(246 - 1, 37 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(176 - 1, 57 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(175 - 1, 58 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(174 - 1, 59 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(173 - 1, 60 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(172 - 1, 63 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(171 - 1, 64 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(170 - 1, 65 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(169 - 1, 68 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(168 - 1, 69 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(167 - 1, 72 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(166 - 1, 78 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(165 - 1, 83 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(164 - 1, 84 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(163 - 1, 87 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(162 - 1, 108 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(161 - 1, 109 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(160 - 1, 110 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(159 - 1, 113 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(158 - 1, 114 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(157 - 1, 117 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(81 - 1, 139 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(80 - 1, 140 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(79 - 1, 141 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(78 - 1, 144 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(77 - 1, 145 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(76 - 1, 148 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(75 - 1, 154 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(74 - 1, 155 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(73 - 1, 158 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(72 - 1, 177 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(71 - 1, 178 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(70 - 1, 181 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(25 - 1, 203 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(24 - 1, 204 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(23 - 1, 207 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(22 - 1, 213 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(21 - 1, 229 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(4 - 1, 251 - 1, c[56]));  
-	triplets.push_back(Triplet< double >(259 - 1, 6 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(258 - 1, 15 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(257 - 1, 16 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(256 - 1, 18 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(255 - 1, 26 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(254 - 1, 27 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(253 - 1, 28 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(252 - 1, 29 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(251 - 1, 31 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(250 - 1, 32 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(249 - 1, 33 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(248 - 1, 35 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(247 - 1, 36 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(246 - 1, 38 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(176 - 1, 61 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(175 - 1, 62 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(174 - 1, 63 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(173 - 1, 64 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(172 - 1, 66 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(171 - 1, 67 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(170 - 1, 68 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(169 - 1, 70 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(168 - 1, 71 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(167 - 1, 73 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(166 - 1, 81 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(165 - 1, 85 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(164 - 1, 86 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(163 - 1, 88 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(162 - 1, 111 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(161 - 1, 112 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(160 - 1, 113 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(159 - 1, 115 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(158 - 1, 116 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(157 - 1, 118 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(81 - 1, 142 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(80 - 1, 143 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(79 - 1, 144 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(78 - 1, 146 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(77 - 1, 147 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(76 - 1, 149 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(75 - 1, 156 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(74 - 1, 157 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(73 - 1, 159 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(72 - 1, 179 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(71 - 1, 180 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(70 - 1, 182 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(25 - 1, 205 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(24 - 1, 206 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(23 - 1, 208 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(22 - 1, 214 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(21 - 1, 230 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(4 - 1, 252 - 1, c[57]));  
-	triplets.push_back(Triplet< double >(259 - 1, 7 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(258 - 1, 16 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(257 - 1, 17 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(256 - 1, 19 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(255 - 1, 27 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(254 - 1, 28 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(253 - 1, 29 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(252 - 1, 30 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(251 - 1, 32 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(250 - 1, 33 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(249 - 1, 34 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(248 - 1, 36 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(247 - 1, 37 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(246 - 1, 39 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(176 - 1, 62 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(175 - 1, 63 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(174 - 1, 64 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(173 - 1, 65 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(172 - 1, 67 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(171 - 1, 68 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(170 - 1, 69 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(169 - 1, 71 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(168 - 1, 72 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(167 - 1, 74 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(166 - 1, 82 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(165 - 1, 86 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(164 - 1, 87 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(163 - 1, 89 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(162 - 1, 112 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(161 - 1, 113 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(160 - 1, 114 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(159 - 1, 116 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(158 - 1, 117 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(157 - 1, 119 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(81 - 1, 143 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(80 - 1, 144 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(79 - 1, 145 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(78 - 1, 147 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(77 - 1, 148 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(76 - 1, 150 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(75 - 1, 157 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(74 - 1, 158 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(73 - 1, 160 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(72 - 1, 180 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(71 - 1, 181 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(70 - 1, 183 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(25 - 1, 206 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(24 - 1, 207 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(23 - 1, 209 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(22 - 1, 215 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(21 - 1, 231 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(4 - 1, 253 - 1, c[58]));  
-	triplets.push_back(Triplet< double >(259 - 1, 11 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(258 - 1, 18 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(257 - 1, 19 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(256 - 1, 20 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(255 - 1, 31 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(254 - 1, 32 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(253 - 1, 33 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(252 - 1, 34 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(251 - 1, 35 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(250 - 1, 36 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(249 - 1, 37 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(248 - 1, 38 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(247 - 1, 39 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(246 - 1, 40 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(176 - 1, 66 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(175 - 1, 67 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(174 - 1, 68 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(173 - 1, 69 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(172 - 1, 70 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(171 - 1, 71 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(170 - 1, 72 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(169 - 1, 73 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(168 - 1, 74 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(167 - 1, 75 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(166 - 1, 85 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(165 - 1, 88 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(164 - 1, 89 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(163 - 1, 90 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(162 - 1, 115 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(161 - 1, 116 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(160 - 1, 117 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(159 - 1, 118 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(158 - 1, 119 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(157 - 1, 120 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(81 - 1, 146 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(80 - 1, 147 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(79 - 1, 148 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(78 - 1, 149 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(77 - 1, 150 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(76 - 1, 151 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(75 - 1, 159 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(74 - 1, 160 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(73 - 1, 161 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(72 - 1, 182 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(71 - 1, 183 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(70 - 1, 184 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(25 - 1, 208 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(24 - 1, 209 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(23 - 1, 210 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(22 - 1, 216 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(21 - 1, 232 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(4 - 1, 254 - 1, c[59]));  
-	triplets.push_back(Triplet< double >(258 - 1, 31 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(257 - 1, 32 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(256 - 1, 35 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(251 - 1, 41 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(250 - 1, 42 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(249 - 1, 43 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(248 - 1, 46 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(247 - 1, 47 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(246 - 1, 50 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(172 - 1, 91 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(171 - 1, 92 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(170 - 1, 93 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(169 - 1, 96 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(168 - 1, 97 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(167 - 1, 100 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(166 - 1, 106 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(165 - 1, 111 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(164 - 1, 112 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(163 - 1, 115 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(162 - 1, 121 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(161 - 1, 122 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(160 - 1, 123 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(159 - 1, 124 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(158 - 1, 125 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(157 - 1, 128 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(81 - 1, 162 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(80 - 1, 163 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(79 - 1, 164 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(78 - 1, 165 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(77 - 1, 166 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(76 - 1, 169 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(75 - 1, 175 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(74 - 1, 176 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(73 - 1, 179 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(72 - 1, 185 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(71 - 1, 186 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(70 - 1, 189 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(25 - 1, 217 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(24 - 1, 218 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(23 - 1, 221 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(22 - 1, 227 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(21 - 1, 233 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(4 - 1, 258 - 1, c[60]));  
-	triplets.push_back(Triplet< double >(259 - 1, 21 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(258 - 1, 32 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(257 - 1, 33 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(256 - 1, 36 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(251 - 1, 42 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(250 - 1, 43 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(249 - 1, 44 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(248 - 1, 47 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(247 - 1, 48 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(246 - 1, 51 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(172 - 1, 92 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(171 - 1, 93 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(170 - 1, 94 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(169 - 1, 97 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(168 - 1, 98 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(167 - 1, 101 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(166 - 1, 107 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(165 - 1, 112 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(164 - 1, 113 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(163 - 1, 116 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(162 - 1, 122 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(161 - 1, 123 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(159 - 1, 125 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(158 - 1, 126 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(157 - 1, 129 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(81 - 1, 163 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(80 - 1, 164 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(78 - 1, 166 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(77 - 1, 167 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(76 - 1, 170 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(75 - 1, 176 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(74 - 1, 177 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(73 - 1, 180 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(72 - 1, 186 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(71 - 1, 187 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(70 - 1, 190 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(25 - 1, 218 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(24 - 1, 219 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(23 - 1, 222 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(22 - 1, 228 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(21 - 1, 234 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(4 - 1, 259 - 1, c[61]));  
-	triplets.push_back(Triplet< double >(259 - 1, 26 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(258 - 1, 35 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(257 - 1, 36 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(256 - 1, 38 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(255 - 1, 41 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(254 - 1, 42 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(253 - 1, 43 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(252 - 1, 44 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(251 - 1, 46 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(250 - 1, 47 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(249 - 1, 48 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(248 - 1, 50 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(247 - 1, 51 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(246 - 1, 53 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(176 - 1, 91 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(175 - 1, 92 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(174 - 1, 93 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(173 - 1, 94 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(172 - 1, 96 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(171 - 1, 97 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(170 - 1, 98 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(169 - 1, 100 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(168 - 1, 101 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(167 - 1, 103 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(166 - 1, 111 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(165 - 1, 115 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(164 - 1, 116 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(163 - 1, 118 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(162 - 1, 124 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(161 - 1, 125 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(160 - 1, 126 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(159 - 1, 128 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(158 - 1, 129 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(157 - 1, 131 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(81 - 1, 165 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(80 - 1, 166 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(79 - 1, 167 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(78 - 1, 169 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(77 - 1, 170 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(76 - 1, 172 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(75 - 1, 179 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(74 - 1, 180 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(73 - 1, 182 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(72 - 1, 189 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(71 - 1, 190 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(70 - 1, 192 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(25 - 1, 221 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(24 - 1, 222 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(23 - 1, 224 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(22 - 1, 230 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(21 - 1, 236 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(4 - 1, 261 - 1, c[62]));  
-	triplets.push_back(Triplet< double >(259 - 1, 27 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(258 - 1, 36 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(257 - 1, 37 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(256 - 1, 39 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(255 - 1, 42 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(254 - 1, 43 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(253 - 1, 44 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(252 - 1, 45 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(251 - 1, 47 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(250 - 1, 48 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(249 - 1, 49 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(248 - 1, 51 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(247 - 1, 52 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(246 - 1, 54 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(176 - 1, 92 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(175 - 1, 93 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(174 - 1, 94 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(173 - 1, 95 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(172 - 1, 97 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(171 - 1, 98 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(170 - 1, 99 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(169 - 1, 101 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(168 - 1, 102 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(167 - 1, 104 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(166 - 1, 112 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(165 - 1, 116 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(164 - 1, 117 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(163 - 1, 119 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(162 - 1, 125 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(161 - 1, 126 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(160 - 1, 127 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(159 - 1, 129 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(158 - 1, 130 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(157 - 1, 132 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(81 - 1, 166 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(80 - 1, 167 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(79 - 1, 168 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(78 - 1, 170 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(77 - 1, 171 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(76 - 1, 173 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(75 - 1, 180 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(74 - 1, 181 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(73 - 1, 183 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(72 - 1, 190 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(71 - 1, 191 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(70 - 1, 193 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(25 - 1, 222 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(24 - 1, 223 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(23 - 1, 225 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(22 - 1, 231 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(21 - 1, 237 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(4 - 1, 262 - 1, c[63]));  
-	triplets.push_back(Triplet< double >(259 - 1, 31 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(258 - 1, 38 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(257 - 1, 39 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(256 - 1, 40 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(255 - 1, 46 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(254 - 1, 47 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(253 - 1, 48 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(252 - 1, 49 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(251 - 1, 50 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(250 - 1, 51 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(249 - 1, 52 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(248 - 1, 53 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(247 - 1, 54 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(246 - 1, 55 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(176 - 1, 96 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(175 - 1, 97 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(174 - 1, 98 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(173 - 1, 99 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(172 - 1, 100 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(171 - 1, 101 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(170 - 1, 102 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(169 - 1, 103 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(168 - 1, 104 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(167 - 1, 105 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(166 - 1, 115 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(165 - 1, 118 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(164 - 1, 119 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(163 - 1, 120 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(162 - 1, 128 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(161 - 1, 129 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(160 - 1, 130 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(159 - 1, 131 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(158 - 1, 132 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(157 - 1, 133 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(81 - 1, 169 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(80 - 1, 170 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(79 - 1, 171 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(78 - 1, 172 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(77 - 1, 173 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(76 - 1, 174 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(75 - 1, 182 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(74 - 1, 183 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(73 - 1, 184 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(72 - 1, 192 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(71 - 1, 193 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(70 - 1, 194 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(25 - 1, 224 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(24 - 1, 225 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(23 - 1, 226 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(22 - 1, 232 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(21 - 1, 238 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(4 - 1, 263 - 1, c[64]));  
-	triplets.push_back(Triplet< double >(258 - 1, 66 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(257 - 1, 67 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(256 - 1, 70 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(251 - 1, 91 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(250 - 1, 92 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(249 - 1, 93 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(248 - 1, 96 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(247 - 1, 97 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(246 - 1, 100 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(171 - 1, 134 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(170 - 1, 135 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(168 - 1, 136 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(166 - 1, 137 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(165 - 1, 142 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(164 - 1, 143 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(163 - 1, 146 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(162 - 1, 162 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(161 - 1, 163 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(160 - 1, 164 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(159 - 1, 165 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(158 - 1, 166 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(157 - 1, 169 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(81 - 1, 195 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(80 - 1, 196 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(79 - 1, 197 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(78 - 1, 198 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(77 - 1, 199 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(76 - 1, 200 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(75 - 1, 201 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(74 - 1, 202 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(73 - 1, 205 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(72 - 1, 217 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(71 - 1, 218 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(70 - 1, 221 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(25 - 1, 239 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(24 - 1, 240 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(23 - 1, 243 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(22 - 1, 249 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(21 - 1, 258 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(4 - 1, 270 - 1, c[65]));  
-	triplets.push_back(Triplet< double >(259 - 1, 56 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(258 - 1, 67 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(257 - 1, 68 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(256 - 1, 71 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(251 - 1, 92 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(250 - 1, 93 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(249 - 1, 94 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(248 - 1, 97 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(247 - 1, 98 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(246 - 1, 101 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(172 - 1, 134 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(171 - 1, 135 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(169 - 1, 136 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(166 - 1, 138 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(165 - 1, 143 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(164 - 1, 144 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(163 - 1, 147 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(162 - 1, 163 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(161 - 1, 164 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(159 - 1, 166 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(158 - 1, 167 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(157 - 1, 170 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(81 - 1, 196 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(80 - 1, 197 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(78 - 1, 199 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(75 - 1, 202 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(74 - 1, 203 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(73 - 1, 206 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(72 - 1, 218 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(71 - 1, 219 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(70 - 1, 222 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(25 - 1, 240 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(24 - 1, 241 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(23 - 1, 244 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(22 - 1, 250 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(21 - 1, 259 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(4 - 1, 271 - 1, c[66]));  
-	triplets.push_back(Triplet< double >(259 - 1, 57 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(258 - 1, 68 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(257 - 1, 69 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(256 - 1, 72 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(251 - 1, 93 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(250 - 1, 94 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(249 - 1, 95 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(248 - 1, 98 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(247 - 1, 99 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(246 - 1, 102 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(172 - 1, 135 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(166 - 1, 139 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(165 - 1, 144 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(164 - 1, 145 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(163 - 1, 148 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(162 - 1, 164 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(159 - 1, 167 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(158 - 1, 168 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(157 - 1, 171 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(81 - 1, 197 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(75 - 1, 203 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(74 - 1, 204 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(73 - 1, 207 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(72 - 1, 219 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(71 - 1, 220 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(70 - 1, 223 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(25 - 1, 241 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(24 - 1, 242 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(23 - 1, 245 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(22 - 1, 251 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(21 - 1, 260 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(4 - 1, 272 - 1, c[67]));  
-	triplets.push_back(Triplet< double >(259 - 1, 61 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(258 - 1, 70 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(257 - 1, 71 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(256 - 1, 73 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(255 - 1, 91 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(254 - 1, 92 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(253 - 1, 93 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(252 - 1, 94 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(251 - 1, 96 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(250 - 1, 97 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(249 - 1, 98 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(248 - 1, 100 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(247 - 1, 101 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(246 - 1, 103 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(175 - 1, 134 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(174 - 1, 135 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(171 - 1, 136 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(166 - 1, 142 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(165 - 1, 146 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(164 - 1, 147 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(163 - 1, 149 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(162 - 1, 165 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(161 - 1, 166 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(160 - 1, 167 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(159 - 1, 169 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(158 - 1, 170 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(157 - 1, 172 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(81 - 1, 198 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(80 - 1, 199 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(78 - 1, 200 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(75 - 1, 205 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(74 - 1, 206 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(73 - 1, 208 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(72 - 1, 221 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(71 - 1, 222 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(70 - 1, 224 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(25 - 1, 243 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(24 - 1, 244 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(23 - 1, 246 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(22 - 1, 252 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(21 - 1, 261 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(4 - 1, 273 - 1, c[68]));  
-	triplets.push_back(Triplet< double >(259 - 1, 62 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(258 - 1, 71 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(257 - 1, 72 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(256 - 1, 74 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(255 - 1, 92 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(254 - 1, 93 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(253 - 1, 94 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(252 - 1, 95 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(251 - 1, 97 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(250 - 1, 98 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(249 - 1, 99 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(248 - 1, 101 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(247 - 1, 102 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(246 - 1, 104 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(176 - 1, 134 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(175 - 1, 135 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(172 - 1, 136 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(166 - 1, 143 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(165 - 1, 147 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(164 - 1, 148 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(163 - 1, 150 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(162 - 1, 166 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(161 - 1, 167 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(160 - 1, 168 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(159 - 1, 170 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(158 - 1, 171 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(157 - 1, 173 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(81 - 1, 199 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(75 - 1, 206 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(74 - 1, 207 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(73 - 1, 209 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(72 - 1, 222 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(71 - 1, 223 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(70 - 1, 225 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(25 - 1, 244 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(24 - 1, 245 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(23 - 1, 247 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(22 - 1, 253 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(21 - 1, 262 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(4 - 1, 274 - 1, c[69]));  
-	triplets.push_back(Triplet< double >(259 - 1, 76 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(258 - 1, 85 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(257 - 1, 86 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(256 - 1, 88 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(255 - 1, 106 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(254 - 1, 107 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(253 - 1, 108 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(252 - 1, 109 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(251 - 1, 111 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(250 - 1, 112 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(249 - 1, 113 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(248 - 1, 115 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(247 - 1, 116 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(246 - 1, 118 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(176 - 1, 137 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(175 - 1, 138 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(174 - 1, 139 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(173 - 1, 140 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(172 - 1, 142 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(171 - 1, 143 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(170 - 1, 144 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(169 - 1, 146 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(168 - 1, 147 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(167 - 1, 149 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(166 - 1, 152 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(165 - 1, 156 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(164 - 1, 157 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(163 - 1, 159 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(162 - 1, 175 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(161 - 1, 176 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(160 - 1, 177 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(159 - 1, 179 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(158 - 1, 180 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(157 - 1, 182 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(81 - 1, 201 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(80 - 1, 202 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(79 - 1, 203 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(78 - 1, 205 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(77 - 1, 206 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(76 - 1, 208 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(75 - 1, 211 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(74 - 1, 212 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(73 - 1, 214 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(72 - 1, 227 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(71 - 1, 228 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(70 - 1, 230 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(25 - 1, 249 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(24 - 1, 250 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(23 - 1, 252 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(22 - 1, 255 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(21 - 1, 264 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(4 - 1, 276 - 1, c[70]));  
-	triplets.push_back(Triplet< double >(259 - 1, 77 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(258 - 1, 86 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(257 - 1, 87 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(256 - 1, 89 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(255 - 1, 107 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(254 - 1, 108 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(253 - 1, 109 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(252 - 1, 110 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(251 - 1, 112 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(250 - 1, 113 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(249 - 1, 114 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(248 - 1, 116 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(247 - 1, 117 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(246 - 1, 119 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(176 - 1, 138 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(175 - 1, 139 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(174 - 1, 140 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(173 - 1, 141 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(172 - 1, 143 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(171 - 1, 144 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(170 - 1, 145 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(169 - 1, 147 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(168 - 1, 148 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(167 - 1, 150 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(166 - 1, 153 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(165 - 1, 157 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(164 - 1, 158 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(163 - 1, 160 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(162 - 1, 176 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(161 - 1, 177 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(160 - 1, 178 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(159 - 1, 180 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(158 - 1, 181 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(157 - 1, 183 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(81 - 1, 202 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(80 - 1, 203 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(79 - 1, 204 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(78 - 1, 206 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(77 - 1, 207 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(76 - 1, 209 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(75 - 1, 212 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(74 - 1, 213 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(73 - 1, 215 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(72 - 1, 228 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(71 - 1, 229 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(70 - 1, 231 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(25 - 1, 250 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(24 - 1, 251 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(23 - 1, 253 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(22 - 1, 256 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(21 - 1, 265 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(4 - 1, 277 - 1, c[71]));  
-	triplets.push_back(Triplet< double >(259 - 1, 81 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(258 - 1, 88 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(257 - 1, 89 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(256 - 1, 90 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(255 - 1, 111 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(254 - 1, 112 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(253 - 1, 113 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(252 - 1, 114 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(251 - 1, 115 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(250 - 1, 116 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(249 - 1, 117 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(248 - 1, 118 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(247 - 1, 119 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(246 - 1, 120 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(176 - 1, 142 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(175 - 1, 143 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(174 - 1, 144 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(173 - 1, 145 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(172 - 1, 146 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(171 - 1, 147 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(170 - 1, 148 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(169 - 1, 149 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(168 - 1, 150 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(167 - 1, 151 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(166 - 1, 156 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(165 - 1, 159 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(164 - 1, 160 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(163 - 1, 161 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(162 - 1, 179 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(161 - 1, 180 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(160 - 1, 181 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(159 - 1, 182 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(158 - 1, 183 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(157 - 1, 184 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(81 - 1, 205 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(80 - 1, 206 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(79 - 1, 207 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(78 - 1, 208 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(77 - 1, 209 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(76 - 1, 210 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(75 - 1, 214 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(74 - 1, 215 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(73 - 1, 216 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(72 - 1, 230 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(71 - 1, 231 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(70 - 1, 232 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(25 - 1, 252 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(24 - 1, 253 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(23 - 1, 254 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(22 - 1, 257 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(21 - 1, 266 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(4 - 1, 278 - 1, c[72]));  
-	triplets.push_back(Triplet< double >(259 - 1, 106 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(258 - 1, 115 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(257 - 1, 116 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(256 - 1, 118 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(255 - 1, 121 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(254 - 1, 122 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(253 - 1, 123 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(251 - 1, 124 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(250 - 1, 125 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(249 - 1, 126 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(248 - 1, 128 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(247 - 1, 129 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(246 - 1, 131 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(176 - 1, 162 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(175 - 1, 163 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(174 - 1, 164 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(172 - 1, 165 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(171 - 1, 166 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(170 - 1, 167 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(169 - 1, 169 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(168 - 1, 170 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(167 - 1, 172 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(166 - 1, 175 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(165 - 1, 179 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(164 - 1, 180 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(163 - 1, 182 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(162 - 1, 185 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(161 - 1, 186 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(160 - 1, 187 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(159 - 1, 189 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(158 - 1, 190 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(157 - 1, 192 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(81 - 1, 217 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(80 - 1, 218 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(79 - 1, 219 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(78 - 1, 221 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(77 - 1, 222 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(76 - 1, 224 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(75 - 1, 227 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(74 - 1, 228 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(73 - 1, 230 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(72 - 1, 233 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(71 - 1, 234 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(70 - 1, 236 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(25 - 1, 258 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(24 - 1, 259 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(23 - 1, 261 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(22 - 1, 264 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(21 - 1, 267 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(4 - 1, 280 - 1, c[73]));  
-	triplets.push_back(Triplet< double >(259 - 1, 107 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(258 - 1, 116 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(257 - 1, 117 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(256 - 1, 119 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(255 - 1, 122 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(254 - 1, 123 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(251 - 1, 125 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(250 - 1, 126 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(249 - 1, 127 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(248 - 1, 129 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(247 - 1, 130 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(246 - 1, 132 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(176 - 1, 163 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(175 - 1, 164 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(172 - 1, 166 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(171 - 1, 167 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(170 - 1, 168 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(169 - 1, 170 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(168 - 1, 171 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(167 - 1, 173 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(166 - 1, 176 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(165 - 1, 180 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(164 - 1, 181 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(163 - 1, 183 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(162 - 1, 186 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(161 - 1, 187 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(160 - 1, 188 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(159 - 1, 190 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(158 - 1, 191 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(157 - 1, 193 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(81 - 1, 218 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(80 - 1, 219 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(79 - 1, 220 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(78 - 1, 222 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(77 - 1, 223 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(76 - 1, 225 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(75 - 1, 228 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(74 - 1, 229 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(73 - 1, 231 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(72 - 1, 234 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(71 - 1, 235 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(70 - 1, 237 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(25 - 1, 259 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(24 - 1, 260 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(23 - 1, 262 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(22 - 1, 265 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(21 - 1, 268 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(4 - 1, 281 - 1, c[74]));  
-	triplets.push_back(Triplet< double >(259 - 1, 111 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(258 - 1, 118 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(257 - 1, 119 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(256 - 1, 120 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(255 - 1, 124 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(254 - 1, 125 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(253 - 1, 126 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(252 - 1, 127 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(251 - 1, 128 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(250 - 1, 129 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(249 - 1, 130 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(248 - 1, 131 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(247 - 1, 132 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(246 - 1, 133 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(176 - 1, 165 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(175 - 1, 166 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(174 - 1, 167 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(173 - 1, 168 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(172 - 1, 169 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(171 - 1, 170 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(170 - 1, 171 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(169 - 1, 172 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(168 - 1, 173 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(167 - 1, 174 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(166 - 1, 179 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(165 - 1, 182 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(164 - 1, 183 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(163 - 1, 184 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(162 - 1, 189 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(161 - 1, 190 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(160 - 1, 191 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(159 - 1, 192 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(158 - 1, 193 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(157 - 1, 194 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(81 - 1, 221 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(80 - 1, 222 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(79 - 1, 223 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(78 - 1, 224 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(77 - 1, 225 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(76 - 1, 226 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(75 - 1, 230 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(74 - 1, 231 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(73 - 1, 232 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(72 - 1, 236 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(71 - 1, 237 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(70 - 1, 238 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(25 - 1, 261 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(24 - 1, 262 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(23 - 1, 263 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(22 - 1, 266 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(21 - 1, 269 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(4 - 1, 282 - 1, c[75]));  
-	triplets.push_back(Triplet< double >(259 - 1, 137 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(258 - 1, 146 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(257 - 1, 147 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(256 - 1, 149 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(255 - 1, 162 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(254 - 1, 163 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(253 - 1, 164 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(251 - 1, 165 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(250 - 1, 166 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(249 - 1, 167 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(248 - 1, 169 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(247 - 1, 170 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(246 - 1, 172 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(176 - 1, 195 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(175 - 1, 196 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(174 - 1, 197 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(172 - 1, 198 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(171 - 1, 199 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(169 - 1, 200 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(166 - 1, 201 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(165 - 1, 205 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(164 - 1, 206 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(163 - 1, 208 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(162 - 1, 217 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(161 - 1, 218 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(160 - 1, 219 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(159 - 1, 221 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(158 - 1, 222 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(157 - 1, 224 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(81 - 1, 239 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(80 - 1, 240 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(79 - 1, 241 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(78 - 1, 243 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(77 - 1, 244 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(76 - 1, 246 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(75 - 1, 249 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(74 - 1, 250 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(73 - 1, 252 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(72 - 1, 258 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(71 - 1, 259 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(70 - 1, 261 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(25 - 1, 270 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(24 - 1, 271 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(23 - 1, 273 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(22 - 1, 276 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(21 - 1, 280 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(4 - 1, 285 - 1, c[76]));  
-	triplets.push_back(Triplet< double >(259 - 1, 138 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(258 - 1, 147 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(257 - 1, 148 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(256 - 1, 150 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(255 - 1, 163 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(254 - 1, 164 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(251 - 1, 166 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(250 - 1, 167 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(249 - 1, 168 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(248 - 1, 170 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(247 - 1, 171 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(246 - 1, 173 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(176 - 1, 196 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(175 - 1, 197 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(172 - 1, 199 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(166 - 1, 202 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(165 - 1, 206 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(164 - 1, 207 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(163 - 1, 209 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(162 - 1, 218 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(161 - 1, 219 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(160 - 1, 220 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(159 - 1, 222 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(158 - 1, 223 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(157 - 1, 225 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(81 - 1, 240 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(80 - 1, 241 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(79 - 1, 242 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(78 - 1, 244 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(77 - 1, 245 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(76 - 1, 247 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(75 - 1, 250 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(74 - 1, 251 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(73 - 1, 253 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(72 - 1, 259 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(71 - 1, 260 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(70 - 1, 262 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(25 - 1, 271 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(24 - 1, 272 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(23 - 1, 274 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(22 - 1, 277 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(21 - 1, 281 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(4 - 1, 286 - 1, c[77]));  
-	triplets.push_back(Triplet< double >(259 - 1, 142 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(258 - 1, 149 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(257 - 1, 150 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(256 - 1, 151 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(255 - 1, 165 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(254 - 1, 166 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(253 - 1, 167 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(252 - 1, 168 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(251 - 1, 169 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(250 - 1, 170 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(249 - 1, 171 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(248 - 1, 172 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(247 - 1, 173 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(246 - 1, 174 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(176 - 1, 198 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(175 - 1, 199 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(172 - 1, 200 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(166 - 1, 205 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(165 - 1, 208 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(164 - 1, 209 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(163 - 1, 210 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(162 - 1, 221 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(161 - 1, 222 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(160 - 1, 223 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(159 - 1, 224 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(158 - 1, 225 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(157 - 1, 226 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(81 - 1, 243 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(80 - 1, 244 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(79 - 1, 245 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(78 - 1, 246 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(77 - 1, 247 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(76 - 1, 248 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(75 - 1, 252 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(74 - 1, 253 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(73 - 1, 254 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(72 - 1, 261 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(71 - 1, 262 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(70 - 1, 263 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(25 - 1, 273 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(24 - 1, 274 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(23 - 1, 275 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(22 - 1, 278 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(21 - 1, 282 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(4 - 1, 287 - 1, c[78]));  
-	triplets.push_back(Triplet< double >(259 - 1, 152 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(258 - 1, 159 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(257 - 1, 160 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(256 - 1, 161 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(255 - 1, 175 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(254 - 1, 176 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(253 - 1, 177 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(252 - 1, 178 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(251 - 1, 179 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(250 - 1, 180 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(249 - 1, 181 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(248 - 1, 182 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(247 - 1, 183 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(246 - 1, 184 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(176 - 1, 201 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(175 - 1, 202 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(174 - 1, 203 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(173 - 1, 204 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(172 - 1, 205 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(171 - 1, 206 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(170 - 1, 207 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(169 - 1, 208 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(168 - 1, 209 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(167 - 1, 210 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(166 - 1, 211 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(165 - 1, 214 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(164 - 1, 215 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(163 - 1, 216 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(162 - 1, 227 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(161 - 1, 228 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(160 - 1, 229 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(159 - 1, 230 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(158 - 1, 231 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(157 - 1, 232 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(81 - 1, 249 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(80 - 1, 250 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(79 - 1, 251 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(78 - 1, 252 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(77 - 1, 253 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(76 - 1, 254 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(75 - 1, 255 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(74 - 1, 256 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(73 - 1, 257 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(72 - 1, 264 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(71 - 1, 265 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(70 - 1, 266 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(25 - 1, 276 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(24 - 1, 277 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(23 - 1, 278 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(22 - 1, 279 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(21 - 1, 283 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(4 - 1, 288 - 1, c[79]));  
-	triplets.push_back(Triplet< double >(259 - 1, 175 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(258 - 1, 182 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(257 - 1, 183 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(256 - 1, 184 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(255 - 1, 185 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(254 - 1, 186 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(253 - 1, 187 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(252 - 1, 188 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(251 - 1, 189 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(250 - 1, 190 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(249 - 1, 191 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(248 - 1, 192 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(247 - 1, 193 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(246 - 1, 194 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(176 - 1, 217 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(175 - 1, 218 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(174 - 1, 219 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(173 - 1, 220 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(172 - 1, 221 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(171 - 1, 222 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(170 - 1, 223 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(169 - 1, 224 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(168 - 1, 225 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(167 - 1, 226 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(166 - 1, 227 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(165 - 1, 230 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(164 - 1, 231 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(163 - 1, 232 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(162 - 1, 233 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(161 - 1, 234 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(160 - 1, 235 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(159 - 1, 236 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(158 - 1, 237 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(157 - 1, 238 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(81 - 1, 258 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(80 - 1, 259 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(79 - 1, 260 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(78 - 1, 261 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(77 - 1, 262 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(76 - 1, 263 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(75 - 1, 264 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(74 - 1, 265 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(73 - 1, 266 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(72 - 1, 267 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(71 - 1, 268 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(70 - 1, 269 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(25 - 1, 280 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(24 - 1, 281 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(23 - 1, 282 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(22 - 1, 283 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(21 - 1, 284 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(4 - 1, 289 - 1, c[80]));  
-	triplets.push_back(Triplet< double >(259 - 1, 201 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(258 - 1, 208 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(257 - 1, 209 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(256 - 1, 210 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(255 - 1, 217 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(254 - 1, 218 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(253 - 1, 219 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(252 - 1, 220 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(251 - 1, 221 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(250 - 1, 222 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(249 - 1, 223 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(248 - 1, 224 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(247 - 1, 225 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(246 - 1, 226 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(176 - 1, 239 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(175 - 1, 240 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(174 - 1, 241 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(173 - 1, 242 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(172 - 1, 243 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(171 - 1, 244 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(170 - 1, 245 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(169 - 1, 246 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(168 - 1, 247 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(167 - 1, 248 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(166 - 1, 249 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(165 - 1, 252 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(164 - 1, 253 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(163 - 1, 254 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(162 - 1, 258 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(161 - 1, 259 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(160 - 1, 260 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(159 - 1, 261 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(158 - 1, 262 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(157 - 1, 263 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(81 - 1, 270 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(80 - 1, 271 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(79 - 1, 272 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(78 - 1, 273 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(77 - 1, 274 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(76 - 1, 275 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(75 - 1, 276 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(74 - 1, 277 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(73 - 1, 278 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(72 - 1, 280 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(71 - 1, 281 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(70 - 1, 282 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(25 - 1, 285 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(24 - 1, 286 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(23 - 1, 287 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(22 - 1, 288 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(21 - 1, 289 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(4 - 1, 290 - 1, c[81]));  
-	triplets.push_back(Triplet< double >(269 - 1, 21 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(268 - 1, 22 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(267 - 1, 23 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(266 - 1, 24 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(265 - 1, 27 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(264 - 1, 28 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(263 - 1, 29 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(262 - 1, 32 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(261 - 1, 33 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(260 - 1, 36 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(195 - 1, 56 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(194 - 1, 57 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(193 - 1, 58 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(192 - 1, 59 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(191 - 1, 62 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(190 - 1, 63 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(189 - 1, 64 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(188 - 1, 67 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(187 - 1, 68 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(186 - 1, 71 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(185 - 1, 77 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(184 - 1, 83 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(183 - 1, 86 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(182 - 1, 107 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(181 - 1, 108 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(180 - 1, 109 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(179 - 1, 112 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(178 - 1, 113 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(177 - 1, 116 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(93 - 1, 138 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(92 - 1, 139 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(91 - 1, 140 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(90 - 1, 143 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(89 - 1, 144 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(88 - 1, 147 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(87 - 1, 153 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(86 - 1, 154 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(85 - 1, 157 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(84 - 1, 176 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(83 - 1, 177 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(82 - 1, 180 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(30 - 1, 202 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(29 - 1, 203 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(28 - 1, 206 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(27 - 1, 212 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(26 - 1, 228 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(5 - 1, 250 - 1, c[82]));  
-	triplets.push_back(Triplet< double >(269 - 1, 22 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(268 - 1, 23 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(267 - 1, 24 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(266 - 1, 25 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(265 - 1, 28 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(264 - 1, 29 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(263 - 1, 30 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(262 - 1, 33 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(261 - 1, 34 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(260 - 1, 37 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(195 - 1, 57 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(194 - 1, 58 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(193 - 1, 59 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(192 - 1, 60 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(191 - 1, 63 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(190 - 1, 64 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(189 - 1, 65 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(188 - 1, 68 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(187 - 1, 69 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(186 - 1, 72 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(185 - 1, 78 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(184 - 1, 84 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(183 - 1, 87 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(182 - 1, 108 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(181 - 1, 109 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(180 - 1, 110 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(179 - 1, 113 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(178 - 1, 114 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(177 - 1, 117 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(93 - 1, 139 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(92 - 1, 140 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(91 - 1, 141 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(90 - 1, 144 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(89 - 1, 145 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(88 - 1, 148 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(87 - 1, 154 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(86 - 1, 155 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(85 - 1, 158 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(84 - 1, 177 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(83 - 1, 178 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(82 - 1, 181 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(30 - 1, 203 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(29 - 1, 204 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(28 - 1, 207 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(27 - 1, 213 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(26 - 1, 229 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(5 - 1, 251 - 1, c[83]));  
-	triplets.push_back(Triplet< double >(269 - 1, 26 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(268 - 1, 27 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(267 - 1, 28 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(266 - 1, 29 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(265 - 1, 31 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(264 - 1, 32 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(263 - 1, 33 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(262 - 1, 35 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(261 - 1, 36 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(260 - 1, 38 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(195 - 1, 61 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(194 - 1, 62 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(193 - 1, 63 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(192 - 1, 64 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(191 - 1, 66 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(190 - 1, 67 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(189 - 1, 68 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(188 - 1, 70 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(187 - 1, 71 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(186 - 1, 73 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(185 - 1, 81 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(184 - 1, 86 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(183 - 1, 88 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(182 - 1, 111 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(181 - 1, 112 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(180 - 1, 113 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(179 - 1, 115 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(178 - 1, 116 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(177 - 1, 118 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(93 - 1, 142 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(92 - 1, 143 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(91 - 1, 144 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(90 - 1, 146 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(89 - 1, 147 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(88 - 1, 149 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(87 - 1, 156 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(86 - 1, 157 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(85 - 1, 159 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(84 - 1, 179 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(83 - 1, 180 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(82 - 1, 182 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(30 - 1, 205 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(29 - 1, 206 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(28 - 1, 208 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(27 - 1, 214 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(26 - 1, 230 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(5 - 1, 252 - 1, c[84]));  
-	triplets.push_back(Triplet< double >(269 - 1, 27 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(268 - 1, 28 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(267 - 1, 29 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(266 - 1, 30 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(265 - 1, 32 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(264 - 1, 33 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(263 - 1, 34 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(262 - 1, 36 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(261 - 1, 37 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(260 - 1, 39 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(195 - 1, 62 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(194 - 1, 63 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(193 - 1, 64 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(192 - 1, 65 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(191 - 1, 67 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(190 - 1, 68 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(189 - 1, 69 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(188 - 1, 71 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(187 - 1, 72 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(186 - 1, 74 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(185 - 1, 82 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(184 - 1, 87 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(183 - 1, 89 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(182 - 1, 112 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(181 - 1, 113 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(180 - 1, 114 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(179 - 1, 116 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(178 - 1, 117 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(177 - 1, 119 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(93 - 1, 143 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(92 - 1, 144 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(91 - 1, 145 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(90 - 1, 147 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(89 - 1, 148 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(88 - 1, 150 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(87 - 1, 157 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(86 - 1, 158 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(85 - 1, 160 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(84 - 1, 180 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(83 - 1, 181 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(82 - 1, 183 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(30 - 1, 206 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(29 - 1, 207 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(28 - 1, 209 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(27 - 1, 215 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(26 - 1, 231 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(5 - 1, 253 - 1, c[85]));  
-	triplets.push_back(Triplet< double >(269 - 1, 31 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(268 - 1, 32 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(267 - 1, 33 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(266 - 1, 34 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(265 - 1, 35 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(264 - 1, 36 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(263 - 1, 37 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(262 - 1, 38 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(261 - 1, 39 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(260 - 1, 40 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(195 - 1, 66 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(194 - 1, 67 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(193 - 1, 68 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(192 - 1, 69 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(191 - 1, 70 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(190 - 1, 71 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(189 - 1, 72 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(188 - 1, 73 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(187 - 1, 74 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(186 - 1, 75 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(185 - 1, 85 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(184 - 1, 89 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(183 - 1, 90 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(182 - 1, 115 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(181 - 1, 116 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(180 - 1, 117 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(179 - 1, 118 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(178 - 1, 119 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(177 - 1, 120 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(93 - 1, 146 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(92 - 1, 147 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(91 - 1, 148 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(90 - 1, 149 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(89 - 1, 150 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(88 - 1, 151 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(87 - 1, 159 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(86 - 1, 160 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(85 - 1, 161 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(84 - 1, 182 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(83 - 1, 183 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(82 - 1, 184 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(30 - 1, 208 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(29 - 1, 209 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(28 - 1, 210 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(27 - 1, 216 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(26 - 1, 232 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(5 - 1, 254 - 1, c[86]));  
-	triplets.push_back(Triplet< double >(265 - 1, 41 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(264 - 1, 42 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(263 - 1, 43 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(262 - 1, 46 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(261 - 1, 47 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(260 - 1, 50 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(191 - 1, 91 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(190 - 1, 92 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(189 - 1, 93 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(188 - 1, 96 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(187 - 1, 97 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(186 - 1, 100 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(185 - 1, 106 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(184 - 1, 112 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(183 - 1, 115 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(182 - 1, 121 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(181 - 1, 122 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(180 - 1, 123 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(179 - 1, 124 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(178 - 1, 125 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(177 - 1, 128 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(93 - 1, 162 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(92 - 1, 163 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(91 - 1, 164 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(90 - 1, 165 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(89 - 1, 166 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(88 - 1, 169 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(87 - 1, 175 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(86 - 1, 176 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(85 - 1, 179 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(84 - 1, 185 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(83 - 1, 186 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(82 - 1, 189 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(30 - 1, 217 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(29 - 1, 218 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(28 - 1, 221 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(27 - 1, 227 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(26 - 1, 233 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(5 - 1, 258 - 1, c[87]));  
-	triplets.push_back(Triplet< double >(265 - 1, 42 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(264 - 1, 43 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(263 - 1, 44 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(262 - 1, 47 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(261 - 1, 48 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(260 - 1, 51 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(191 - 1, 92 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(190 - 1, 93 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(189 - 1, 94 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(188 - 1, 97 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(187 - 1, 98 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(186 - 1, 101 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(185 - 1, 107 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(184 - 1, 113 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(183 - 1, 116 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(182 - 1, 122 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(181 - 1, 123 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(179 - 1, 125 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(178 - 1, 126 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(177 - 1, 129 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(93 - 1, 163 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(92 - 1, 164 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(90 - 1, 166 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(89 - 1, 167 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(88 - 1, 170 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(87 - 1, 176 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(86 - 1, 177 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(85 - 1, 180 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(84 - 1, 186 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(83 - 1, 187 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(82 - 1, 190 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(30 - 1, 218 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(29 - 1, 219 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(28 - 1, 222 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(27 - 1, 228 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(26 - 1, 234 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(5 - 1, 259 - 1, c[88]));  
-	triplets.push_back(Triplet< double >(269 - 1, 41 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(268 - 1, 42 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(267 - 1, 43 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(266 - 1, 44 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(265 - 1, 46 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(264 - 1, 47 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(263 - 1, 48 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(262 - 1, 50 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(261 - 1, 51 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(260 - 1, 53 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(195 - 1, 91 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(194 - 1, 92 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(193 - 1, 93 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(192 - 1, 94 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(191 - 1, 96 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(190 - 1, 97 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(189 - 1, 98 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(188 - 1, 100 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(187 - 1, 101 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(186 - 1, 103 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(185 - 1, 111 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(184 - 1, 116 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(183 - 1, 118 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(182 - 1, 124 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(181 - 1, 125 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(180 - 1, 126 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(179 - 1, 128 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(178 - 1, 129 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(177 - 1, 131 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(93 - 1, 165 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(92 - 1, 166 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(91 - 1, 167 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(90 - 1, 169 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(89 - 1, 170 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(88 - 1, 172 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(87 - 1, 179 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(86 - 1, 180 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(85 - 1, 182 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(84 - 1, 189 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(83 - 1, 190 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(82 - 1, 192 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(30 - 1, 221 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(29 - 1, 222 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(28 - 1, 224 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(27 - 1, 230 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(26 - 1, 236 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(5 - 1, 261 - 1, c[89]));  
-	triplets.push_back(Triplet< double >(269 - 1, 42 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(268 - 1, 43 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(267 - 1, 44 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(266 - 1, 45 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(265 - 1, 47 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(264 - 1, 48 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(263 - 1, 49 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(262 - 1, 51 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(261 - 1, 52 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(260 - 1, 54 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(195 - 1, 92 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(194 - 1, 93 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(193 - 1, 94 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(192 - 1, 95 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(191 - 1, 97 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(190 - 1, 98 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(189 - 1, 99 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(188 - 1, 101 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(187 - 1, 102 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(186 - 1, 104 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(185 - 1, 112 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(184 - 1, 117 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(183 - 1, 119 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(182 - 1, 125 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(181 - 1, 126 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(180 - 1, 127 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(179 - 1, 129 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(178 - 1, 130 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(177 - 1, 132 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(93 - 1, 166 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(92 - 1, 167 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(91 - 1, 168 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(90 - 1, 170 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(89 - 1, 171 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(88 - 1, 173 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(87 - 1, 180 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(86 - 1, 181 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(85 - 1, 183 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(84 - 1, 190 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(83 - 1, 191 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(82 - 1, 193 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(30 - 1, 222 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(29 - 1, 223 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(28 - 1, 225 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(27 - 1, 231 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(26 - 1, 237 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(5 - 1, 262 - 1, c[90]));  
-	triplets.push_back(Triplet< double >(269 - 1, 46 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(268 - 1, 47 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(267 - 1, 48 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(266 - 1, 49 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(265 - 1, 50 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(264 - 1, 51 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(263 - 1, 52 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(262 - 1, 53 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(261 - 1, 54 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(260 - 1, 55 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(195 - 1, 96 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(194 - 1, 97 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(193 - 1, 98 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(192 - 1, 99 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(191 - 1, 100 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(190 - 1, 101 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(189 - 1, 102 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(188 - 1, 103 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(187 - 1, 104 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(186 - 1, 105 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(185 - 1, 115 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(184 - 1, 119 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(183 - 1, 120 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(182 - 1, 128 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(181 - 1, 129 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(180 - 1, 130 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(179 - 1, 131 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(178 - 1, 132 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(177 - 1, 133 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(93 - 1, 169 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(92 - 1, 170 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(91 - 1, 171 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(90 - 1, 172 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(89 - 1, 173 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(88 - 1, 174 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(87 - 1, 182 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(86 - 1, 183 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(85 - 1, 184 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(84 - 1, 192 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(83 - 1, 193 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(82 - 1, 194 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(30 - 1, 224 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(29 - 1, 225 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(28 - 1, 226 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(27 - 1, 232 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(26 - 1, 238 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(5 - 1, 263 - 1, c[91]));  
-	triplets.push_back(Triplet< double >(265 - 1, 91 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(264 - 1, 92 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(263 - 1, 93 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(262 - 1, 96 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(261 - 1, 97 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(260 - 1, 100 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(190 - 1, 134 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(189 - 1, 135 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(187 - 1, 136 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(185 - 1, 137 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(184 - 1, 143 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(183 - 1, 146 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(182 - 1, 162 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(181 - 1, 163 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(180 - 1, 164 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(179 - 1, 165 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(178 - 1, 166 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(177 - 1, 169 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(93 - 1, 195 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(92 - 1, 196 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(91 - 1, 197 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(90 - 1, 198 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(89 - 1, 199 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(88 - 1, 200 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(87 - 1, 201 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(86 - 1, 202 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(85 - 1, 205 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(84 - 1, 217 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(83 - 1, 218 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(82 - 1, 221 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(30 - 1, 239 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(29 - 1, 240 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(28 - 1, 243 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(27 - 1, 249 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(26 - 1, 258 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(5 - 1, 270 - 1, c[92]));  
-	triplets.push_back(Triplet< double >(265 - 1, 92 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(264 - 1, 93 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(263 - 1, 94 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(262 - 1, 97 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(261 - 1, 98 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(260 - 1, 101 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(191 - 1, 134 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(190 - 1, 135 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(188 - 1, 136 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(185 - 1, 138 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(184 - 1, 144 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(183 - 1, 147 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(182 - 1, 163 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(181 - 1, 164 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(179 - 1, 166 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(178 - 1, 167 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(177 - 1, 170 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(93 - 1, 196 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(92 - 1, 197 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(90 - 1, 199 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(87 - 1, 202 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(86 - 1, 203 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(85 - 1, 206 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(84 - 1, 218 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(83 - 1, 219 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(82 - 1, 222 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(30 - 1, 240 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(29 - 1, 241 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(28 - 1, 244 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(27 - 1, 250 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(26 - 1, 259 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(5 - 1, 271 - 1, c[93]));  
-	triplets.push_back(Triplet< double >(265 - 1, 93 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(264 - 1, 94 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(263 - 1, 95 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(262 - 1, 98 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(261 - 1, 99 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(260 - 1, 102 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(191 - 1, 135 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(185 - 1, 139 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(184 - 1, 145 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(183 - 1, 148 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(182 - 1, 164 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(179 - 1, 167 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(178 - 1, 168 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(177 - 1, 171 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(93 - 1, 197 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(87 - 1, 203 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(86 - 1, 204 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(85 - 1, 207 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(84 - 1, 219 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(83 - 1, 220 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(82 - 1, 223 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(30 - 1, 241 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(29 - 1, 242 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(28 - 1, 245 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(27 - 1, 251 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(26 - 1, 260 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(5 - 1, 272 - 1, c[94]));  
-	triplets.push_back(Triplet< double >(269 - 1, 91 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(268 - 1, 92 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(267 - 1, 93 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(266 - 1, 94 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(265 - 1, 96 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(264 - 1, 97 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(263 - 1, 98 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(262 - 1, 100 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(261 - 1, 101 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(260 - 1, 103 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(194 - 1, 134 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(193 - 1, 135 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(190 - 1, 136 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(185 - 1, 142 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(184 - 1, 147 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(183 - 1, 149 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(182 - 1, 165 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(181 - 1, 166 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(180 - 1, 167 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(179 - 1, 169 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(178 - 1, 170 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(177 - 1, 172 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(93 - 1, 198 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(92 - 1, 199 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(90 - 1, 200 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(87 - 1, 205 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(86 - 1, 206 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(85 - 1, 208 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(84 - 1, 221 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(83 - 1, 222 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(82 - 1, 224 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(30 - 1, 243 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(29 - 1, 244 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(28 - 1, 246 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(27 - 1, 252 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(26 - 1, 261 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(5 - 1, 273 - 1, c[95]));  
-	triplets.push_back(Triplet< double >(269 - 1, 92 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(268 - 1, 93 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(267 - 1, 94 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(266 - 1, 95 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(265 - 1, 97 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(264 - 1, 98 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(263 - 1, 99 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(262 - 1, 101 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(261 - 1, 102 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(260 - 1, 104 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(195 - 1, 134 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(194 - 1, 135 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(191 - 1, 136 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(185 - 1, 143 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(184 - 1, 148 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(183 - 1, 150 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(182 - 1, 166 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(181 - 1, 167 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(180 - 1, 168 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(179 - 1, 170 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(178 - 1, 171 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(177 - 1, 173 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(93 - 1, 199 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(87 - 1, 206 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(86 - 1, 207 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(85 - 1, 209 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(84 - 1, 222 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(83 - 1, 223 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(82 - 1, 225 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(30 - 1, 244 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(29 - 1, 245 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(28 - 1, 247 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(27 - 1, 253 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(26 - 1, 262 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(5 - 1, 274 - 1, c[96]));  
-	triplets.push_back(Triplet< double >(269 - 1, 106 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(268 - 1, 107 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(267 - 1, 108 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(266 - 1, 109 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(265 - 1, 111 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(264 - 1, 112 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(263 - 1, 113 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(262 - 1, 115 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(261 - 1, 116 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(260 - 1, 118 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(195 - 1, 137 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(194 - 1, 138 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(193 - 1, 139 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(192 - 1, 140 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(191 - 1, 142 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(190 - 1, 143 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(189 - 1, 144 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(188 - 1, 146 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(187 - 1, 147 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(186 - 1, 149 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(185 - 1, 152 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(184 - 1, 157 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(183 - 1, 159 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(182 - 1, 175 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(181 - 1, 176 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(180 - 1, 177 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(179 - 1, 179 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(178 - 1, 180 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(177 - 1, 182 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(93 - 1, 201 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(92 - 1, 202 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(91 - 1, 203 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(90 - 1, 205 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(89 - 1, 206 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(88 - 1, 208 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(87 - 1, 211 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(86 - 1, 212 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(85 - 1, 214 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(84 - 1, 227 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(83 - 1, 228 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(82 - 1, 230 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(30 - 1, 249 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(29 - 1, 250 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(28 - 1, 252 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(27 - 1, 255 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(26 - 1, 264 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(5 - 1, 276 - 1, c[97]));  
-	triplets.push_back(Triplet< double >(269 - 1, 107 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(268 - 1, 108 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(267 - 1, 109 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(266 - 1, 110 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(265 - 1, 112 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(264 - 1, 113 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(263 - 1, 114 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(262 - 1, 116 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(261 - 1, 117 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(260 - 1, 119 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(195 - 1, 138 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(194 - 1, 139 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(193 - 1, 140 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(192 - 1, 141 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(191 - 1, 143 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(190 - 1, 144 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(189 - 1, 145 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(188 - 1, 147 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(187 - 1, 148 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(186 - 1, 150 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(185 - 1, 153 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(184 - 1, 158 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(183 - 1, 160 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(182 - 1, 176 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(181 - 1, 177 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(180 - 1, 178 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(179 - 1, 180 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(178 - 1, 181 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(177 - 1, 183 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(93 - 1, 202 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(92 - 1, 203 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(91 - 1, 204 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(90 - 1, 206 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(89 - 1, 207 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(88 - 1, 209 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(87 - 1, 212 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(86 - 1, 213 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(85 - 1, 215 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(84 - 1, 228 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(83 - 1, 229 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(82 - 1, 231 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(30 - 1, 250 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(29 - 1, 251 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(28 - 1, 253 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(27 - 1, 256 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(26 - 1, 265 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(5 - 1, 277 - 1, c[98]));  
-	triplets.push_back(Triplet< double >(269 - 1, 111 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(268 - 1, 112 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(267 - 1, 113 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(266 - 1, 114 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(265 - 1, 115 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(264 - 1, 116 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(263 - 1, 117 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(262 - 1, 118 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(261 - 1, 119 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(260 - 1, 120 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(195 - 1, 142 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(194 - 1, 143 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(193 - 1, 144 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(192 - 1, 145 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(191 - 1, 146 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(190 - 1, 147 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(189 - 1, 148 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(188 - 1, 149 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(187 - 1, 150 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(186 - 1, 151 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(185 - 1, 156 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(184 - 1, 160 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(183 - 1, 161 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(182 - 1, 179 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(181 - 1, 180 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(180 - 1, 181 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(179 - 1, 182 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(178 - 1, 183 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(177 - 1, 184 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(93 - 1, 205 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(92 - 1, 206 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(91 - 1, 207 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(90 - 1, 208 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(89 - 1, 209 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(88 - 1, 210 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(87 - 1, 214 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(86 - 1, 215 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(85 - 1, 216 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(84 - 1, 230 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(83 - 1, 231 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(82 - 1, 232 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(30 - 1, 252 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(29 - 1, 253 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(28 - 1, 254 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(27 - 1, 257 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(26 - 1, 266 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(5 - 1, 278 - 1, c[99]));  
-	triplets.push_back(Triplet< double >(269 - 1, 121 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(268 - 1, 122 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(267 - 1, 123 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(265 - 1, 124 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(264 - 1, 125 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(263 - 1, 126 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(262 - 1, 128 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(261 - 1, 129 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(260 - 1, 131 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(195 - 1, 162 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(194 - 1, 163 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(193 - 1, 164 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(191 - 1, 165 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(190 - 1, 166 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(189 - 1, 167 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(188 - 1, 169 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(187 - 1, 170 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(186 - 1, 172 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(185 - 1, 175 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(184 - 1, 180 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(183 - 1, 182 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(182 - 1, 185 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(181 - 1, 186 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(180 - 1, 187 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(179 - 1, 189 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(178 - 1, 190 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(177 - 1, 192 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(93 - 1, 217 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(92 - 1, 218 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(91 - 1, 219 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(90 - 1, 221 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(89 - 1, 222 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(88 - 1, 224 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(87 - 1, 227 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(86 - 1, 228 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(85 - 1, 230 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(84 - 1, 233 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(83 - 1, 234 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(82 - 1, 236 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(30 - 1, 258 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(29 - 1, 259 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(28 - 1, 261 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(27 - 1, 264 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(26 - 1, 267 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(5 - 1, 280 - 1, c[100]));  
-	triplets.push_back(Triplet< double >(269 - 1, 122 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(268 - 1, 123 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(265 - 1, 125 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(264 - 1, 126 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(263 - 1, 127 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(262 - 1, 129 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(261 - 1, 130 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(260 - 1, 132 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(195 - 1, 163 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(194 - 1, 164 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(191 - 1, 166 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(190 - 1, 167 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(189 - 1, 168 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(188 - 1, 170 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(187 - 1, 171 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(186 - 1, 173 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(185 - 1, 176 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(184 - 1, 181 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(183 - 1, 183 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(182 - 1, 186 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(181 - 1, 187 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(180 - 1, 188 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(179 - 1, 190 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(178 - 1, 191 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(177 - 1, 193 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(93 - 1, 218 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(92 - 1, 219 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(91 - 1, 220 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(90 - 1, 222 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(89 - 1, 223 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(88 - 1, 225 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(87 - 1, 228 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(86 - 1, 229 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(85 - 1, 231 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(84 - 1, 234 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(83 - 1, 235 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(82 - 1, 237 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(30 - 1, 259 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(29 - 1, 260 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(28 - 1, 262 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(27 - 1, 265 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(26 - 1, 268 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(5 - 1, 281 - 1, c[101]));  
-	triplets.push_back(Triplet< double >(269 - 1, 124 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(268 - 1, 125 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(267 - 1, 126 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(266 - 1, 127 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(265 - 1, 128 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(264 - 1, 129 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(263 - 1, 130 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(262 - 1, 131 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(261 - 1, 132 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(260 - 1, 133 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(195 - 1, 165 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(194 - 1, 166 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(193 - 1, 167 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(192 - 1, 168 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(191 - 1, 169 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(190 - 1, 170 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(189 - 1, 171 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(188 - 1, 172 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(187 - 1, 173 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(186 - 1, 174 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(185 - 1, 179 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(184 - 1, 183 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(183 - 1, 184 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(182 - 1, 189 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(181 - 1, 190 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(180 - 1, 191 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(179 - 1, 192 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(178 - 1, 193 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(177 - 1, 194 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(93 - 1, 221 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(92 - 1, 222 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(91 - 1, 223 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(90 - 1, 224 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(89 - 1, 225 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(88 - 1, 226 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(87 - 1, 230 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(86 - 1, 231 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(85 - 1, 232 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(84 - 1, 236 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(83 - 1, 237 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(82 - 1, 238 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(30 - 1, 261 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(29 - 1, 262 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(28 - 1, 263 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(27 - 1, 266 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(26 - 1, 269 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(5 - 1, 282 - 1, c[102]));  
-	triplets.push_back(Triplet< double >(269 - 1, 162 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(268 - 1, 163 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(267 - 1, 164 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(265 - 1, 165 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(264 - 1, 166 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(263 - 1, 167 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(262 - 1, 169 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(261 - 1, 170 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(260 - 1, 172 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(195 - 1, 195 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(194 - 1, 196 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(193 - 1, 197 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(191 - 1, 198 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(190 - 1, 199 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(188 - 1, 200 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(185 - 1, 201 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(184 - 1, 206 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(183 - 1, 208 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(182 - 1, 217 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(181 - 1, 218 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(180 - 1, 219 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(179 - 1, 221 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(178 - 1, 222 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(177 - 1, 224 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(93 - 1, 239 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(92 - 1, 240 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(91 - 1, 241 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(90 - 1, 243 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(89 - 1, 244 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(88 - 1, 246 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(87 - 1, 249 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(86 - 1, 250 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(85 - 1, 252 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(84 - 1, 258 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(83 - 1, 259 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(82 - 1, 261 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(30 - 1, 270 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(29 - 1, 271 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(28 - 1, 273 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(27 - 1, 276 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(26 - 1, 280 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(5 - 1, 285 - 1, c[103]));  
-	triplets.push_back(Triplet< double >(269 - 1, 163 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(268 - 1, 164 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(265 - 1, 166 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(264 - 1, 167 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(263 - 1, 168 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(262 - 1, 170 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(261 - 1, 171 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(260 - 1, 173 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(195 - 1, 196 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(194 - 1, 197 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(191 - 1, 199 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(185 - 1, 202 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(184 - 1, 207 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(183 - 1, 209 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(182 - 1, 218 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(181 - 1, 219 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(180 - 1, 220 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(179 - 1, 222 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(178 - 1, 223 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(177 - 1, 225 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(93 - 1, 240 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(92 - 1, 241 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(91 - 1, 242 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(90 - 1, 244 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(89 - 1, 245 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(88 - 1, 247 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(87 - 1, 250 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(86 - 1, 251 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(85 - 1, 253 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(84 - 1, 259 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(83 - 1, 260 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(82 - 1, 262 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(30 - 1, 271 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(29 - 1, 272 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(28 - 1, 274 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(27 - 1, 277 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(26 - 1, 281 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(5 - 1, 286 - 1, c[104]));  
-	triplets.push_back(Triplet< double >(269 - 1, 165 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(268 - 1, 166 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(267 - 1, 167 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(266 - 1, 168 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(265 - 1, 169 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(264 - 1, 170 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(263 - 1, 171 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(262 - 1, 172 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(261 - 1, 173 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(260 - 1, 174 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(195 - 1, 198 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(194 - 1, 199 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(191 - 1, 200 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(185 - 1, 205 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(184 - 1, 209 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(183 - 1, 210 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(182 - 1, 221 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(181 - 1, 222 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(180 - 1, 223 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(179 - 1, 224 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(178 - 1, 225 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(177 - 1, 226 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(93 - 1, 243 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(92 - 1, 244 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(91 - 1, 245 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(90 - 1, 246 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(89 - 1, 247 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(88 - 1, 248 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(87 - 1, 252 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(86 - 1, 253 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(85 - 1, 254 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(84 - 1, 261 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(83 - 1, 262 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(82 - 1, 263 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(30 - 1, 273 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(29 - 1, 274 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(28 - 1, 275 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(27 - 1, 278 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(26 - 1, 282 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(5 - 1, 287 - 1, c[105]));  
-	triplets.push_back(Triplet< double >(269 - 1, 175 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(268 - 1, 176 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(267 - 1, 177 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(266 - 1, 178 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(265 - 1, 179 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(264 - 1, 180 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(263 - 1, 181 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(262 - 1, 182 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(261 - 1, 183 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(260 - 1, 184 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(195 - 1, 201 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(194 - 1, 202 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(193 - 1, 203 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(192 - 1, 204 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(191 - 1, 205 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(190 - 1, 206 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(189 - 1, 207 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(188 - 1, 208 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(187 - 1, 209 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(186 - 1, 210 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(185 - 1, 211 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(184 - 1, 215 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(183 - 1, 216 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(182 - 1, 227 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(181 - 1, 228 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(180 - 1, 229 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(179 - 1, 230 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(178 - 1, 231 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(177 - 1, 232 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(93 - 1, 249 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(92 - 1, 250 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(91 - 1, 251 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(90 - 1, 252 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(89 - 1, 253 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(88 - 1, 254 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(87 - 1, 255 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(86 - 1, 256 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(85 - 1, 257 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(84 - 1, 264 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(83 - 1, 265 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(82 - 1, 266 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(30 - 1, 276 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(29 - 1, 277 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(28 - 1, 278 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(27 - 1, 279 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(26 - 1, 283 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(5 - 1, 288 - 1, c[106]));  
-	triplets.push_back(Triplet< double >(269 - 1, 185 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(268 - 1, 186 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(267 - 1, 187 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(266 - 1, 188 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(265 - 1, 189 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(264 - 1, 190 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(263 - 1, 191 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(262 - 1, 192 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(261 - 1, 193 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(260 - 1, 194 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(195 - 1, 217 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(194 - 1, 218 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(193 - 1, 219 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(192 - 1, 220 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(191 - 1, 221 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(190 - 1, 222 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(189 - 1, 223 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(188 - 1, 224 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(187 - 1, 225 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(186 - 1, 226 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(185 - 1, 227 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(184 - 1, 231 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(183 - 1, 232 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(182 - 1, 233 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(181 - 1, 234 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(180 - 1, 235 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(179 - 1, 236 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(178 - 1, 237 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(177 - 1, 238 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(93 - 1, 258 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(92 - 1, 259 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(91 - 1, 260 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(90 - 1, 261 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(89 - 1, 262 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(88 - 1, 263 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(87 - 1, 264 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(86 - 1, 265 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(85 - 1, 266 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(84 - 1, 267 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(83 - 1, 268 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(82 - 1, 269 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(30 - 1, 280 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(29 - 1, 281 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(28 - 1, 282 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(27 - 1, 283 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(26 - 1, 284 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(5 - 1, 289 - 1, c[107]));  
-	triplets.push_back(Triplet< double >(269 - 1, 217 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(268 - 1, 218 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(267 - 1, 219 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(266 - 1, 220 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(265 - 1, 221 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(264 - 1, 222 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(263 - 1, 223 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(262 - 1, 224 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(261 - 1, 225 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(260 - 1, 226 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(195 - 1, 239 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(194 - 1, 240 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(193 - 1, 241 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(192 - 1, 242 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(191 - 1, 243 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(190 - 1, 244 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(189 - 1, 245 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(188 - 1, 246 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(187 - 1, 247 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(186 - 1, 248 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(185 - 1, 249 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(184 - 1, 253 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(183 - 1, 254 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(182 - 1, 258 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(181 - 1, 259 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(180 - 1, 260 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(179 - 1, 261 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(178 - 1, 262 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(177 - 1, 263 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(93 - 1, 270 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(92 - 1, 271 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(91 - 1, 272 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(90 - 1, 273 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(89 - 1, 274 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(88 - 1, 275 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(87 - 1, 276 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(86 - 1, 277 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(85 - 1, 278 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(84 - 1, 280 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(83 - 1, 281 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(82 - 1, 282 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(30 - 1, 285 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(29 - 1, 286 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(28 - 1, 287 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(27 - 1, 288 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(26 - 1, 289 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(5 - 1, 290 - 1, c[108]));  
-	triplets.push_back(Triplet< double >(270 - 1, 50 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(208 - 1, 76 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(207 - 1, 85 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(206 - 1, 96 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(205 - 1, 97 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(204 - 1, 100 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(203 - 1, 106 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(202 - 1, 115 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(201 - 1, 121 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(200 - 1, 122 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(199 - 1, 123 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(198 - 1, 124 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(197 - 1, 125 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(196 - 1, 128 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(113 - 1, 134 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(112 - 1, 135 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(111 - 1, 136 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(110 - 1, 137 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(109 - 1, 146 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(108 - 1, 152 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(107 - 1, 153 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(106 - 1, 156 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(105 - 1, 162 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(104 - 1, 163 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(103 - 1, 164 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(102 - 1, 165 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(101 - 1, 166 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(100 - 1, 169 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(99 - 1, 175 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(98 - 1, 176 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(97 - 1, 179 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(96 - 1, 185 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(95 - 1, 186 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(94 - 1, 189 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(45 - 1, 195 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(44 - 1, 196 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(43 - 1, 197 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(42 - 1, 198 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(41 - 1, 199 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(40 - 1, 200 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(39 - 1, 201 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(38 - 1, 202 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(37 - 1, 205 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(36 - 1, 211 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(35 - 1, 217 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(34 - 1, 218 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(33 - 1, 221 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(32 - 1, 227 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(31 - 1, 233 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(10 - 1, 239 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(9 - 1, 240 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(8 - 1, 243 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(7 - 1, 249 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(6 - 1, 258 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(1 - 1, 270 - 1, c[109]));  
-	triplets.push_back(Triplet< double >(270 - 1, 52 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(208 - 1, 78 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(207 - 1, 87 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(206 - 1, 98 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(205 - 1, 99 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(204 - 1, 102 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(203 - 1, 108 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(202 - 1, 117 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(201 - 1, 123 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(198 - 1, 126 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(197 - 1, 127 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(196 - 1, 130 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(110 - 1, 139 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(109 - 1, 148 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(108 - 1, 154 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(107 - 1, 155 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(106 - 1, 158 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(105 - 1, 164 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(102 - 1, 167 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(101 - 1, 168 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(100 - 1, 171 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(99 - 1, 177 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(98 - 1, 178 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(97 - 1, 181 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(96 - 1, 187 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(95 - 1, 188 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(94 - 1, 191 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(45 - 1, 197 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(39 - 1, 203 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(38 - 1, 204 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(37 - 1, 207 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(36 - 1, 213 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(35 - 1, 219 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(34 - 1, 220 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(33 - 1, 223 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(32 - 1, 229 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(31 - 1, 235 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(10 - 1, 241 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(9 - 1, 242 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(8 - 1, 245 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(7 - 1, 251 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(6 - 1, 260 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(1 - 1, 272 - 1, c[110]));  
-	triplets.push_back(Triplet< double >(270 - 1, 55 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(208 - 1, 85 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(207 - 1, 90 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(206 - 1, 103 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(205 - 1, 104 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(204 - 1, 105 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(203 - 1, 115 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(202 - 1, 120 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(201 - 1, 128 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(200 - 1, 129 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(199 - 1, 130 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(198 - 1, 131 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(197 - 1, 132 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(196 - 1, 133 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(110 - 1, 146 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(109 - 1, 151 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(108 - 1, 159 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(107 - 1, 160 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(106 - 1, 161 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(105 - 1, 169 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(104 - 1, 170 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(103 - 1, 171 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(102 - 1, 172 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(101 - 1, 173 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(100 - 1, 174 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(99 - 1, 182 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(98 - 1, 183 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(97 - 1, 184 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(96 - 1, 192 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(95 - 1, 193 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(94 - 1, 194 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(45 - 1, 200 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(39 - 1, 208 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(38 - 1, 209 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(37 - 1, 210 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(36 - 1, 216 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(35 - 1, 224 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(34 - 1, 225 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(33 - 1, 226 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(32 - 1, 232 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(31 - 1, 238 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(10 - 1, 246 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(9 - 1, 247 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(8 - 1, 248 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(7 - 1, 254 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(6 - 1, 263 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(1 - 1, 275 - 1, c[111]));  
-	triplets.push_back(Triplet< double >(270 - 1, 194 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(208 - 1, 211 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(207 - 1, 216 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(206 - 1, 224 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(205 - 1, 225 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(204 - 1, 226 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(203 - 1, 227 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(202 - 1, 232 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(201 - 1, 233 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(200 - 1, 234 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(199 - 1, 235 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(198 - 1, 236 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(197 - 1, 237 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(196 - 1, 238 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(113 - 1, 244 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(112 - 1, 245 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(111 - 1, 247 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(110 - 1, 249 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(109 - 1, 254 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(108 - 1, 255 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(107 - 1, 256 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(106 - 1, 257 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(105 - 1, 258 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(104 - 1, 259 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(103 - 1, 260 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(102 - 1, 261 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(101 - 1, 262 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(100 - 1, 263 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(99 - 1, 264 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(98 - 1, 265 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(97 - 1, 266 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(96 - 1, 267 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(95 - 1, 268 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(94 - 1, 269 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(45 - 1, 270 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(44 - 1, 271 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(43 - 1, 272 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(42 - 1, 273 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(41 - 1, 274 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(40 - 1, 275 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(39 - 1, 276 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(38 - 1, 277 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(37 - 1, 278 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(36 - 1, 279 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(35 - 1, 280 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(34 - 1, 281 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(33 - 1, 282 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(32 - 1, 283 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(31 - 1, 284 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(10 - 1, 285 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(9 - 1, 286 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(8 - 1, 287 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(7 - 1, 288 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(6 - 1, 289 - 1, c[112]));  
-	triplets.push_back(Triplet< double >(1 - 1, 290 - 1, c[112]));  
-    
-    SparseMatrix< double > M(270, 290); 
-    M.setFromTriplets(triplets.begin(), triplets.end()); 
-
-    _M = M;   
-    
 }
@@ -28,12 +28,23 @@
 #define FOUR_POINT_GROEBNER_HPP
 
 #include <opencv2/opencv.hpp>
+
+// Factorization used to eliminate the Groebner basis template. 
+// GROEBNER_SPQR needs the library built with FOUR_POINT_GROEBNER_USE_SPQR. 
+enum { GROEBNER_SPARSE_QR = 0, GROEBNER_SPQR = 1, GROEBNER_DENSE_LU = 2 }; 
+
 void four_point_groebner(cv::InputArray _points1, cv::InputArray _points2, 
                 double angle, double focal, cv::Point2d pp, 
-                cv::OutputArray _rvecs, cv::OutputArray _tvecs); 
+                cv::OutputArray _rvecs, cv::OutputArray _tvecs, 
+                int backend = GROEBNER_SPARSE_QR); 
 void findPose4pt_groebner(cv::InputArray points1, cv::InputArray points2, 
               double angle, double focal, cv::Point2d pp, 
               cv::OutputArray rvecs, cv::OutputArray tvecs, 
-              int method, double prob, double threshold, cv::OutputArray _mask); 
+              int method, double prob, double threshold, cv::OutputArray _mask, 
+              int backend = GROEBNER_SPARSE_QR, int maxIters = 2000); 
+
+// Number of minimal samples solved so far, and how many of them were 
+// ill-conditioned and re-solved in long double. Clears both if reset. 
+void four_point_groebner_stats(int & nsamples, int & nfallbacks, bool reset = false); 
 
 #endif
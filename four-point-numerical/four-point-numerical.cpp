@@ -317,7 +317,7 @@ protected:
 }; 
 
 CvFourPointEstimator::CvFourPointEstimator( double _angle )
-: CvModelEstimator2( 4, cvSize(6, 1),  400 ), 
+: CvModelEstimator2( 4, cvSize(6, 1),  200 ), 
   angle( _angle ) 
 {
 }
@@ -336,13 +336,16 @@ int CvFourPointEstimator::runKernel( const CvMat* q1, const CvMat* q2, CvMat* _r
     tvecs = tvecs.t(); 
     double * rt = _rvec_tvec->data.db; 
 
-    for (int i = 0; i < rvecs.rows; i++)
+    // The solutions come in pairs of +tvec and -tvec, which have the 
+    // same error. Only the +tvec one is scored, the sign is fixed after 
+    // RANSAC by a cheirality vote. 
+    for (int i = 0; i < rvecs.rows / 2; i++)
     {
-        memcpy(rt + i * 6, rvecs.ptr<double>(i), 3 * sizeof(double)); 
-        memcpy(rt + i * 6 + 3, tvecs.ptr<double>(i), 3 * sizeof(double)); 
+        memcpy(rt + i * 6, rvecs.ptr<double>(i * 2), 3 * sizeof(double)); 
+        memcpy(rt + i * 6 + 3, tvecs.ptr<double>(i * 2), 3 * sizeof(double)); 
     }
  
-    return rvecs.rows; 
+    return rvecs.rows / 2; 
 
 }
 
@@ -390,6 +393,44 @@ void CvFourPointEstimator::computeReprojError( const CvMat* m1, const CvMat* m2,
 }    
 
 
+/*
+ * t and -t give the same essential matrix up to sign, so RANSAC only 
+ * scores one of them. The sign is resolved by a cheirality vote: each 
+ * inlier is triangulated with +t, and it votes for +t if its depths in 
+ * both cameras are positive, or for -t if both are negative. 
+ * Returns true if -t wins. 
+ */
+static bool four_point_flip_translation(const Mat & points1, const Mat & points2, const Mat & mask, 
+               const Mat & rvec, const Mat & tvec)
+{
+    Mat rmat; 
+    Rodrigues(rvec, rmat); 
+    Matx33d R(rmat.ptr<double>()); 
+    Vec3d t(tvec.ptr<double>()); 
+
+    const Vec2d * x1s = points1.ptr<Vec2d>(); 
+    const Vec2d * x2s = points2.ptr<Vec2d>(); 
+    const uchar * m = mask.ptr<uchar>(); 
+    int n = points1.checkVector(2); 
+
+    int positive = 0, negative = 0; 
+    for (int i = 0; i < n; i++)
+    {
+        if (!m[i]) continue; 
+        Vec3d x1(x1s[i][0], x1s[i][1], 1.0); 
+        Vec3d x2(x2s[i][0], x2s[i][1], 1.0); 
+        Vec3d Rx1 = R * x1; 
+
+        // From d2 * x2 = d1 * R * x1 + t 
+        Vec3d a = x2.cross(Rx1), b = Rx1.cross(x2); 
+        double d1 = -x2.cross(t).dot(a); 
+        double d2 = Rx1.cross(t).dot(b); 
+        if (d1 > 0 && d2 > 0) positive++; 
+        else if (d1 < 0 && d2 < 0) negative++; 
+    }
+    return negative > positive; 
+}
+
 void findPose4pt_numerical(cv::InputArray _points1, cv::InputArray _points2, 
               double angle, double focal, cv::Point2d pp, 
               cv::OutputArray _rvecs, cv::OutputArray _tvecs, 
@@ -481,14 +522,20 @@ void findPose4pt_numerical(cv::InputArray _points1, cv::InputArray _points2,
         }
         else 
         {
+            // The cheirality-consistent sign of tvec comes first
+            Mat rvec = rvec_tvec.colRange(0, 3).t() * 1.0; 
+            Mat tvec = rvec_tvec.colRange(3, 6).t() * 1.0; 
+            if (four_point_flip_translation(points1, points2, Mat(tempMask), rvec, tvec)) 
+                tvec = -tvec; 
+
             _rvecs.create(3, 2, CV_64F, -1, true); 
             _tvecs.create(3, 2, CV_64F, -1, true); 
     
-            _rvecs.getMat().col(0) = rvec_tvec.colRange(0, 3).t() * 1.0; 
-            _tvecs.getMat().col(0) = rvec_tvec.colRange(3, 6).t() * 1.0; 
+            _rvecs.getMat().col(0) = rvec * 1.0; 
+            _tvecs.getMat().col(0) = tvec * 1.0; 
     
-            _rvecs.getMat().col(1) = rvec_tvec.colRange(0, 3).t() * 1.0; 
-            _tvecs.getMat().col(1) = -rvec_tvec.colRange(3, 6).t() * 1.0; 
+            _rvecs.getMat().col(1) = rvec * 1.0; 
+            _tvecs.getMat().col(1) = -tvec * 1.0; 
 
         }
     }
@@ -38,28 +38,42 @@ class CvOnePointEstimator : public CvModelEstimator2
 public:
     CvOnePointEstimator(); 
     virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model ); 
+    bool runVoting( const CvMat* m1, const CvMat* m2, CvMat* model, 
+                    CvMat* mask, double threshold ); 
 protected: 
     virtual void computeReprojError( const CvMat* m1, const CvMat* m2,
                                      const CvMat* model, CvMat* error );
+    virtual int findInliers( const CvMat* m1, const CvMat* m2,
+                             const CvMat* model, CvMat* error,
+                             CvMat* mask, double threshold );
+    virtual int computeInlierBits( const CvMat* m1, const CvMat* m2,
+                                   const CvMat* model, CvMat* error,
+                                   uint64* bits, double threshold );
+    virtual void prepareScoring( const CvMat* m1, const CvMat* m2 ); 
+private: 
+    int prepared( const CvMat* m1, const CvMat* m2 ) const; 
+    int score( double theta, const CvMat* m1, const CvMat* m2, float* err, 
+               uchar* mask, uint64* bits, double threshold2 ) const; 
+
+    // Per-point terms of the Sampson error, in structure-of-arrays 
+    // layout, for the point set given to prepareScoring. 
+    const double * prepared1; 
+    const double * prepared2; 
+    std::vector<double> su, sv, sw, sx1, sx2; 
 }; 
 
 
 CvOnePointEstimator::CvOnePointEstimator()
-: CvModelEstimator2( 1, cvSize(1, 1), 1 ) 
+: CvModelEstimator2( 1, cvSize(1, 1), 1 ), 
+  prepared1( NULL ), prepared2( NULL ) 
 {
 }
 
 
-// Notice to keep compatibility with opencv ransac, q1 and q2 have
-// to be of 1 row x n col x 2 channel. 
-int CvOnePointEstimator::runKernel( const CvMat* q1, const CvMat* q2, CvMat* _theta )
+// Rotation angle given by a single correspondence, in the image 
+// coord system. 
+static inline double one_point_theta(double x1, double y1, double x2, double y2)
 {
-    double x1, y1, x2, y2; 
-    x1 = q1->data.db[0]; 
-    y1 = q1->data.db[1]; 
-    x2 = q2->data.db[0]; 
-    y2 = q2->data.db[1]; 
-
     // Transform the coord to be consistent with Scaramuzza's paper. 
     double x, y, z, x_, y_, z_; 
     x = x_ = 1; 
@@ -73,49 +87,246 @@ int CvOnePointEstimator::runKernel( const CvMat* q1, const CvMat* q2, CvMat* _th
     // Back transform angle.
     // This angle (-theta) is the vehicle turning angle in image coord system. 
     // Note the rotation angle for image coord system should be theta. 
-    _theta->data.db[0] = -theta; 
- 
+    return -theta; 
+}
+
+// Notice to keep compatibility with opencv ransac, q1 and q2 have
+// to be of 1 row x n col x 2 channel. 
+int CvOnePointEstimator::runKernel( const CvMat* q1, const CvMat* q2, CvMat* _theta )
+{
+    _theta->data.db[0] = one_point_theta(q1->data.db[0], q1->data.db[1], 
+                                         q2->data.db[0], q2->data.db[1]); 
     return 1 ; 
 }
 
-// Same as the runKernel, m1 and m2 should be
-// 1 row x n col x 2 channels. 
-// And also, error has to be of CV_32FC1. 
-void CvOnePointEstimator::computeReprojError( const CvMat* m1, const CvMat* m2,
-                                     const CvMat* model, CvMat* error )
+// Histogram voting from Scaramuzza's paper. Every correspondence gives 
+// a theta, and the mode of the thetas is taken instead of running 
+// RANSAC. The mode is then refined by the median theta of its inliers. 
+// Thetas are only defined up to pi, so the histogram wraps around. 
+bool CvOnePointEstimator::runVoting( const CvMat* m1, const CvMat* m2, CvMat* model, 
+                                     CvMat* mask, double threshold )
+{
+    int count = m1->cols; 
+    const double * q1 = m1->data.db; 
+    const double * q2 = m2->data.db; 
+
+    // 0.1 degree bins over [-pi/2, pi/2)
+    const int nbins = 1800; 
+    const double binWidth = CV_PI / nbins; 
+    std::vector<double> thetas(count); 
+    std::vector<int> hist(nbins, 0); 
+    for (int i = 0; i < count; i++)
+    {
+        thetas[i] = one_point_theta(q1[i * 2], q1[i * 2 + 1], q2[i * 2], q2[i * 2 + 1]); 
+        int bin = cvFloor((thetas[i] + CV_PI / 2) / binWidth); 
+        hist[std::min(std::max(bin, 0), nbins - 1)]++; 
+    }
+
+    // Peak of the histogram smoothed by a sliding window of 5 bins
+    const int halfWindow = 2; 
+    int votes = 0; 
+    for (int k = -halfWindow; k <= halfWindow; k++)
+        votes += hist[(k + nbins) % nbins]; 
+    int bestBin = 0, bestVotes = votes; 
+    for (int b = 1; b < nbins; b++)
+    {
+        votes += hist[(b + halfWindow) % nbins] - hist[(b - halfWindow - 1 + nbins) % nbins]; 
+        if (votes > bestVotes)
+        {
+            bestVotes = votes; 
+            bestBin = b; 
+        }
+    }
+    double theta = -CV_PI / 2 + (bestBin + 0.5) * binWidth; 
+
+    Ptr<CvMat> err = cvCreateMat( 1, count, CV_32FC1 ); 
+    prepareScoring( m1, m2 ); 
+    model->data.db[0] = theta; 
+    int goodCount = findInliers( m1, m2, model, err, mask, threshold ); 
+    if (goodCount == 0) return false; 
+
+    std::vector<double> inlierThetas; 
+    for (int i = 0; i < count; i++)
+    {
+        if (!mask->data.ptr[i]) continue; 
+        double d = thetas[i] - theta; 
+        if (d > CV_PI / 2) d -= CV_PI; 
+        if (d < -CV_PI / 2) d += CV_PI; 
+        inlierThetas.push_back(theta + d); 
+    }
+    std::nth_element(inlierThetas.begin(), inlierThetas.begin() + inlierThetas.size() / 2, inlierThetas.end()); 
+    theta = inlierThetas[inlierThetas.size() / 2]; 
+    if (theta > CV_PI / 2) theta -= CV_PI; 
+    if (theta < -CV_PI / 2) theta += CV_PI; 
+
+    model->data.db[0] = theta; 
+    goodCount = findInliers( m1, m2, model, err, mask, threshold ); 
+    return goodCount > 0; 
+}
+
+/*
+ * E of the 1-point model has only four non-zeros, 
+ * 
+ *         | 0  -c   0 |
+ *     E = | c   0  -s |,  c = cos(theta / 2), s = sin(theta / 2), 
+ *         | 0  -s   0 |
+ * 
+ * so the Sampson error of a correspondence reduces to 
+ * 
+ *     x2'Ex1 = c * u - s * v, 
+ *     (Ex1)_1^2 + (Ex1)_2^2 + (E'x2)_1^2 + (E'x2)_2^2 
+ *            = c^2 * w + (c * x1 - s)^2 + (c * x2 + s)^2, 
+ * 
+ * with u = x1 * y2 - x2 * y1, v = y1 + y2 and w = y1^2 + y2^2. These 
+ * terms do not depend on theta and are computed once per point set, 
+ * before RANSAC starts scoring. Scoring may run on several threads, so 
+ * it only reads them. 
+ */
+void CvOnePointEstimator::prepareScoring( const CvMat* m1, const CvMat* m2 )
 {
-    Mat X1(m1), X2(m2); 
-    int n = X1.cols; 
-    X1 = X1.reshape(1, n); 
-    X2 = X2.reshape(1, n); 
+    int count = m1->rows * m1->cols; 
+    su.resize(count); sv.resize(count); sw.resize(count); 
+    sx1.resize(count); sx2.resize(count); 
+    const double * q1 = m1->data.db; 
+    const double * q2 = m2->data.db; 
+    for (int i = 0; i < count; i++)
+    {
+        double x1 = q1[i * 2], y1 = q1[i * 2 + 1]; 
+        double x2 = q2[i * 2], y2 = q2[i * 2 + 1]; 
+        su[i] = x1 * y2 - x2 * y1; 
+        sv[i] = y1 + y2; 
+        sw[i] = y1 * y1 + y2 * y2; 
+        sx1[i] = x1; 
+        sx2[i] = x2; 
+    }
+    prepared1 = m1->data.db; 
+    prepared2 = m2->data.db; 
+}
 
-    X1.convertTo(X1, CV_64F); 
-    X2.convertTo(X2, CV_64F); 
+// Offset of m1, m2 in the prepared point set, or -1 if they are not a 
+// range of it (e.g. a stratified subset, which is scored directly). 
+int CvOnePointEstimator::prepared( const CvMat* m1, const CvMat* m2 ) const
+{
+    int count = m1->rows * m1->cols; 
+    if (!prepared1 || m1->data.db < prepared1 || m2->data.db < prepared2) 
+        return -1; 
+    ptrdiff_t offset = (m1->data.db - prepared1) / 2; 
+    if (m2->data.db - prepared2 != offset * 2 || offset + count > (ptrdiff_t)su.size()) 
+        return -1; 
+    return (int)offset; 
+}
 
-    double theta = model->data.db[0]; 
+// Writes the Sampson error of every point to err. If mask (one byte per 
+// point) or bits (one bit per point) is given, also marks the points with 
+// error <= threshold2 and returns their count. 
+int CvOnePointEstimator::score( double theta, const CvMat* m1, const CvMat* m2, float* err, 
+                                uchar* mask, uint64* bits, double threshold2 ) const
+{
+    int i = 0, count = m1->rows * m1->cols, goodCount = 0; 
+    double c = cos(theta * 0.5), s = sin(theta * 0.5); 
+    if (bits) 
+        memset(bits, 0, (count + 63) / 64 * sizeof(uint64)); 
 
-    // Note this E is for image normal camera system, not the system in 1-pt paper
-    Mat E = (Mat_<double>(3, 3) << 0, -cos(theta * 0.5), 0, 
-                                   cos(theta * 0.5), 0, -sin(theta * 0.5), 
-                                   0, -sin(theta * 0.5), 0); 
-    for (int i = 0; i < n; i++)
+    int offset = prepared(m1, m2); 
+    if (offset < 0)
     {
-        Mat x1 = (Mat_<double>(3, 1) << X1.at<double>(i, 0), X1.at<double>(i, 1), 1.0); 
-        Mat x2 = (Mat_<double>(3, 1) << X2.at<double>(i, 0), X2.at<double>(i, 1), 1.0); 
-        double x2tEx1 = x2.dot(E * x1); 
-        Mat Ex1 = E * x1; 
-        Mat Etx2 = E * x2; 
-        double a = Ex1.at<double>(0) * Ex1.at<double>(0); 
-        double b = Ex1.at<double>(1) * Ex1.at<double>(1); 
-        double c = Etx2.at<double>(0) * Etx2.at<double>(0); 
-        double d = Etx2.at<double>(0) * Etx2.at<double>(0); 
+        const double * q1 = m1->data.db; 
+        const double * q2 = m2->data.db; 
+        for (; i < count; i++)
+        {
+            double x1 = q1[i * 2], y1 = q1[i * 2 + 1]; 
+            double x2 = q2[i * 2], y2 = q2[i * 2 + 1]; 
+            double num = c * (x1 * y2 - x2 * y1) - s * (y1 + y2); 
+            double a = c * x1 - s; 
+            double b = c * x2 + s; 
+            double e = num * num / (c * c * (y1 * y1 + y2 * y2) + a * a + b * b); 
+            err[i] = (float)e; 
+            if (mask) goodCount += mask[i] = e <= threshold2; 
+            if (bits && e <= threshold2) 
+            {
+                bits[i >> 6] |= (uint64)1 << (i & 63); 
+                goodCount++; 
+            }
+        }
+        return goodCount; 
+    }
 
-        error->data.fl[i] = x2tEx1 * x2tEx1 / (a + b + c + d); 
+    const double * u = &su[offset], * v = &sv[offset], * w = &sw[offset]; 
+    const double * x1 = &sx1[offset], * x2 = &sx2[offset]; 
 
+#if CV_SSE2
+    if (USE_SSE2)
+    {
+        __m128d c2 = _mm_set1_pd(c), s2 = _mm_set1_pd(s), cc2 = _mm_set1_pd(c * c); 
+        __m128d t2 = _mm_set1_pd(threshold2); 
+        for (; i <= count - 2; i += 2)
+        {
+            __m128d num = _mm_sub_pd(_mm_mul_pd(c2, _mm_loadu_pd(u + i)), _mm_mul_pd(s2, _mm_loadu_pd(v + i))); 
+            __m128d a = _mm_sub_pd(_mm_mul_pd(c2, _mm_loadu_pd(x1 + i)), s2); 
+            __m128d b = _mm_add_pd(_mm_mul_pd(c2, _mm_loadu_pd(x2 + i)), s2); 
+            __m128d den = _mm_add_pd(_mm_mul_pd(cc2, _mm_loadu_pd(w + i)), 
+                                     _mm_add_pd(_mm_mul_pd(a, a), _mm_mul_pd(b, b))); 
+            __m128d e = _mm_div_pd(_mm_mul_pd(num, num), den); 
+            _mm_storel_pi((__m64*)(err + i), _mm_cvtpd_ps(e)); 
+            if (mask || bits)
+            {
+                int in = _mm_movemask_pd(_mm_cmple_pd(e, t2)); 
+                if (mask)
+                {
+                    mask[i] = (uchar)(in & 1); 
+                    mask[i + 1] = (uchar)(in >> 1); 
+                }
+                else 
+                    bits[i >> 6] |= (uint64)in << (i & 63); 
+                goodCount += (in & 1) + (in >> 1); 
+            }
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        double num = c * u[i] - s * v[i]; 
+        double a = c * x1[i] - s; 
+        double b = c * x2[i] + s; 
+        double e = num * num / (c * c * w[i] + a * a + b * b); 
+        err[i] = (float)e; 
+        if (mask) goodCount += mask[i] = e <= threshold2; 
+        if (bits && e <= threshold2) 
+        {
+            bits[i >> 6] |= (uint64)1 << (i & 63); 
+            goodCount++; 
+        }
     }
 
+    return goodCount; 
+}
+
+// Same as the runKernel, m1 and m2 should be
+// 1 row x n col x 2 channels. 
+// And also, error has to be of CV_32FC1. 
+void CvOnePointEstimator::computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error )
+{
+    score(model->data.db[0], m1, m2, error->data.fl, NULL, NULL, 0); 
 }    
 
+// Scores and counts the inliers in a single pass
+int CvOnePointEstimator::findInliers( const CvMat* m1, const CvMat* m2,
+                                      const CvMat* model, CvMat* error,
+                                      CvMat* mask, double threshold )
+{
+    return score(model->data.db[0], m1, m2, error->data.fl, mask->data.ptr, NULL, threshold * threshold); 
+}
+
+// Same for the bitset masks of RANSAC
+int CvOnePointEstimator::computeInlierBits( const CvMat* m1, const CvMat* m2,
+                                            const CvMat* model, CvMat* error,
+                                            uint64* bits, double threshold )
+{
+    return score(model->data.db[0], m1, m2, error->data.fl, NULL, bits, threshold * threshold); 
+}
+
 void findPose1pt(cv::InputArray _points1, cv::InputArray _points2, 
               double focal, cv::Point2d pp, 
               cv::OutputArray _rvec, cv::OutputArray _tvec, 
@@ -156,7 +367,11 @@ void findPose1pt(cv::InputArray _points1, cv::InputArray _points2,
 	
 	assert(npoints >= 1); 
 	threshold /= focal; 
-    if (method == CV_RANSAC)
+    if (method == ONE_POINT_VOTING)
+    {
+        estimator.runVoting(&p1, &p2, &_theta, tempMask, threshold); 
+    }
+    else if (method == CV_RANSAC)
 	{
 		estimator.runRANSAC(&p1, &p2, &_theta, tempMask, threshold, prob); 
 	}
@@ -188,3 +403,209 @@ void findPose1pt(cv::InputArray _points1, cv::InputArray _points2,
     tvec.copyTo(_tvec.getMat()); 
 
 }
+
+
+/*
+ * 2-point planar motion model: yaw plus a translation direction in the 
+ * ground plane, without the non-holonomic constraint of the 1-point 
+ * model. With R a rotation about the y axis and t = (tx, 0, tz), 
+ * 
+ *         |  0  -tz   0 |
+ *     E = | e1   0   e2 |,  tx^2 + tz^2 = e1^2 + e2^2. 
+ *         |  0   tx   0 |
+ * 
+ * The model is stored as (tx, tz, e1, e2) with tx^2 + tz^2 = 1. 
+ */
+
+// Each correspondence gives one linear equation in (tx, tz, e1, e2). 
+// The constraint picks at most two solutions from the 2D null space. 
+static int two_point_planar_kernel(const double * q1, const double * q2, double * models)
+{
+    double a[8]; 
+    for (int i = 0; i < 2; i++)
+    {
+        double u1 = q1[i * 2], v1 = q1[i * 2 + 1]; 
+        double u2 = q2[i * 2], v2 = q2[i * 2 + 1]; 
+        a[i * 4] = v1; 
+        a[i * 4 + 1] = -u2 * v1; 
+        a[i * 4 + 2] = u1 * v2; 
+        a[i * 4 + 3] = v2; 
+    }
+
+    Mat w, u, vt; 
+    SVD::compute(Mat(2, 4, CV_64F, a), w, u, vt, SVD::FULL_UV); 
+    const double * n1 = vt.ptr<double>(2); 
+    const double * n2 = vt.ptr<double>(3); 
+
+    // tx^2 + tz^2 - e1^2 - e2^2 of f = x * n1 + n2 is A x^2 + 2 B x + C
+    double A = n1[0] * n1[0] + n1[1] * n1[1] - n1[2] * n1[2] - n1[3] * n1[3]; 
+    double B = n1[0] * n2[0] + n1[1] * n2[1] - n1[2] * n2[2] - n1[3] * n2[3]; 
+    double C = n2[0] * n2[0] + n2[1] * n2[1] - n2[2] * n2[2] - n2[3] * n2[3]; 
+
+    double f[2][4]; 
+    int nsols = 0; 
+    if (fabs(A) < 1e-12)
+    {
+        // n1 itself is a solution, and at most one more is left
+        memcpy(f[nsols++], n1, 4 * sizeof(double)); 
+        if (fabs(B) > 1e-12)
+        {
+            double x = -C / (2 * B); 
+            for (int k = 0; k < 4; k++) f[nsols][k] = x * n1[k] + n2[k]; 
+            nsols++; 
+        }
+    }
+    else
+    {
+        double disc = B * B - A * C; 
+        if (disc < 0) return 0; 
+        double xs[2] = {(-B + sqrt(disc)) / A, (-B - sqrt(disc)) / A}; 
+        for (int j = 0; j < 2; j++, nsols++)
+            for (int k = 0; k < 4; k++) f[nsols][k] = xs[j] * n1[k] + n2[k]; 
+    }
+
+    int count = 0; 
+    for (int j = 0; j < nsols; j++)
+    {
+        double s = sqrt(f[j][0] * f[j][0] + f[j][1] * f[j][1]); 
+        if (s < DBL_EPSILON) continue; 
+        for (int k = 0; k < 4; k++) models[count * 4 + k] = f[j][k] / s; 
+        count++; 
+    }
+    return count; 
+}
+
+// Converts (tx, tz, e1, e2) to a rotation vector about y and a translation. 
+static void two_point_planar_pose(const double * e, double * rvec, double * tvec)
+{
+    double tx = e[0], tz = e[1], e1 = e[2], e2 = e[3]; 
+    // e1 = tz * cos(a) + tx * sin(a), e2 = tz * sin(a) - tx * cos(a)
+    double c = tz * e1 - tx * e2; 
+    double s = tx * e1 + tz * e2; 
+    rvec[0] = 0; rvec[1] = atan2(s, c); rvec[2] = 0; 
+    tvec[0] = tx; tvec[1] = 0; tvec[2] = tz; 
+}
+
+class CvTwoPointPlanarEstimator : public CvModelEstimator2
+{
+public:
+    CvTwoPointPlanarEstimator(); 
+    virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model ); 
+protected: 
+    virtual void computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error );
+}; 
+
+CvTwoPointPlanarEstimator::CvTwoPointPlanarEstimator()
+: CvModelEstimator2( 2, cvSize(4, 1), 2 ) 
+{
+}
+
+int CvTwoPointPlanarEstimator::runKernel( const CvMat* q1, const CvMat* q2, CvMat* model )
+{
+    return two_point_planar_kernel(q1->data.db, q2->data.db, model->data.db); 
+}
+
+// Sampson error with the four non-zeros of E written out. 
+// m1 and m2 are 1 row x n col x 2 channels, error is CV_32FC1. 
+void CvTwoPointPlanarEstimator::computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error )
+{
+    int count = m1->rows * m1->cols; 
+    const double * q1 = m1->data.db; 
+    const double * q2 = m2->data.db; 
+    const double * e = model->data.db; 
+    double tx = e[0], tz = e[1], e1 = e[2], e2 = e[3]; 
+    float * err = error->data.fl; 
+
+    for (int i = 0; i < count; i++)
+    {
+        double u1 = q1[i * 2], v1 = q1[i * 2 + 1]; 
+        double u2 = q2[i * 2], v2 = q2[i * 2 + 1]; 
+        double x2tEx1 = (tx - tz * u2) * v1 + (e1 * u1 + e2) * v2; 
+        double a = tz * v1; 
+        double b = e1 * u1 + e2; 
+        double c = e1 * v2; 
+        double d = tx - tz * u2; 
+        err[i] = (float)(x2tEx1 * x2tEx1 / (a * a + b * b + c * c + d * d)); 
+    }
+}
+
+void findPose2pt_planar(cv::InputArray _points1, cv::InputArray _points2, 
+              double focal, cv::Point2d pp, 
+              cv::OutputArray _rvecs, cv::OutputArray _tvecs, 
+              int method, double prob, double threshold, OutputArray _mask) 
+{
+	Mat points1, points2; 
+	_points1.getMat().copyTo(points1); 
+	_points2.getMat().copyTo(points2); 
+
+	int npoints = points1.checkVector(2);
+    CV_Assert( npoints >= 2 && points2.checkVector(2) == npoints &&
+				              points1.type() == points2.type());
+
+	if (points1.channels() > 1)
+	{
+		points1 = points1.reshape(1, npoints); 
+		points2 = points2.reshape(1, npoints); 
+	}
+	points1.convertTo(points1, CV_64F); 
+	points2.convertTo(points2, CV_64F); 
+
+	points1.col(0) = (points1.col(0) - pp.x) / focal; 
+	points2.col(0) = (points2.col(0) - pp.x) / focal; 
+	points1.col(1) = (points1.col(1) - pp.y) / focal; 
+	points2.col(1) = (points2.col(1) - pp.y) / focal; 
+	
+	// Reshape data to fit opencv ransac function
+	points1 = points1.reshape(2, 1); 
+	points2 = points2.reshape(2, 1); 
+
+    CvTwoPointPlanarEstimator estimator; 
+    Mat models(2, 4, CV_64F); 
+    int nmodels = 1; 
+
+	CvMat p1 = points1; 
+	CvMat p2 = points2; 
+	CvMat _model = models.row(0); 
+	CvMat* tempMask = cvCreateMat(1, npoints, CV_8U); 
+	
+	threshold /= focal; 
+    if (npoints == 2)
+    {
+        nmodels = two_point_planar_kernel(points1.ptr<double>(), points2.ptr<double>(), models.ptr<double>()); 
+        Mat(tempMask).setTo(true); 
+    }
+    else if (method == CV_RANSAC)
+	{
+		estimator.runRANSAC(&p1, &p2, &_model, tempMask, threshold, prob); 
+	}
+	else
+	{
+		estimator.runLMeDS(&p1, &p2, &_model, tempMask, prob); 
+	}
+
+    if (_mask.needed())
+    {
+    	_mask.create(1, npoints, CV_8U, -1, true); 
+    	Mat mask = _mask.getMat(); 
+    	Mat(tempMask).copyTo(mask); 
+    }
+    cvReleaseMat(&tempMask); 
+
+    // Each model gives the same rotation with +tvec and -tvec
+    _rvecs.create(3, nmodels * 2, CV_64F, -1, true); 
+    _tvecs.create(3, nmodels * 2, CV_64F, -1, true); 
+    Mat rvecs = _rvecs.getMat(), tvecs = _tvecs.getMat(); 
+    for (int i = 0; i < nmodels; i++)
+    {
+        double r[3], t[3]; 
+        two_point_planar_pose(models.ptr<double>(i), r, t); 
+        for (int k = 0; k < 3; k++)
+        {
+            rvecs.at<double>(k, i * 2) = rvecs.at<double>(k, i * 2 + 1) = r[k]; 
+            tvecs.at<double>(k, i * 2) = t[k]; 
+            tvecs.at<double>(k, i * 2 + 1) = -t[k]; 
+        }
+    }
+}
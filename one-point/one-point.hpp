@@ -3,9 +3,20 @@
 
 #include <opencv2/opencv.hpp>
 
+// Extra method for findPose1pt(): take the mode of the per-point 
+// rotation angles by histogram voting instead of running RANSAC/LMedS. 
+enum { ONE_POINT_VOTING = 16 }; 
+
 void findPose1pt(cv::InputArray points1, cv::InputArray points2, 
               double focal, cv::Point2d pp, 
               cv::OutputArray rvec, cv::OutputArray tvec, 
               int method, double prob, double threshold, cv::OutputArray _mask); 
 
+// 2-point planar motion: yaw and translation direction in the ground 
+// plane, without the non-holonomic constraint of findPose1pt(). 
+void findPose2pt_planar(cv::InputArray points1, cv::InputArray points2, 
+              double focal, cv::Point2d pp, 
+              cv::OutputArray rvecs, cv::OutputArray tvecs, 
+              int method, double prob, double threshold, cv::OutputArray _mask); 
+
 #endif
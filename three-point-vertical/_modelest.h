@@ -0,0 +1,181 @@
+/*M///////////////////////////////////////////////////////////////////////////////////////
+//
+//  IMPORTANT: READ BEFORE DOWNLOADING, COPYING, INSTALLING OR USING.
+//
+//  By downloading, copying, installing or using the software you agree to this license.
+//  If you do not agree to this license, do not download, install,
+//  copy or use the software.
+//
+//
+//                        Intel License Agreement
+//                For Open Source Computer Vision Library
+//
+// Copyright (C) 2000, Intel Corporation, all rights reserved.
+// Third party copyrights are property of their respective owners.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+//   * Redistribution's of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//   * Redistribution's in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//   * The name of Intel Corporation may not be used to endorse or promote products
+//     derived from this software without specific prior written permission.
+//
+// This software is provided by the copyright holders and contributors "as is" and
+// any express or implied warranties, including, but not limited to, the implied
+// warranties of merchantability and fitness for a particular purpose are disclaimed.
+// In no event shall the Intel Corporation or contributors be liable for any direct,
+// indirect, incidental, special, exemplary, or consequential damages
+// (including, but not limited to, procurement of substitute goods or services;
+// loss of use, data, or profits; or business interruption) however caused
+// and on any theory of liability, whether in contract, strict liability,
+// or tort (including negligence or otherwise) arising in any way out of
+// the use of this software, even if advised of the possibility of such damage.
+//
+//M*/
+
+
+#ifndef _CV_MODEL_EST_H_
+#define _CV_MODEL_EST_H_
+
+#include "precomp.hpp"
+
+// Counter-based generator: the n-th output only depends on the key
+// (seed) and the stream, so every stream is reproducible and streams
+// can be handed to different threads.
+class CvPhiloxRNG
+{
+public:
+    CvPhiloxRNG( uint64 seed = 0, unsigned stream = 0 )
+    {
+        key[0] = (unsigned)seed; key[1] = (unsigned)(seed >> 32);
+        ctr[0] = ctr[1] = 0; ctr[2] = stream; ctr[3] = 0;
+        pos = 4;
+    }
+    unsigned next() { if( pos == 4 ) generate(); return out[pos++]; }
+    unsigned uniform( unsigned n );
+
+private:
+    void generate();
+    unsigned key[2], ctr[4], out[4];
+    int pos;
+};
+
+class CvModelEstimator2
+{
+public:
+    // How runRANSAC ranks hypotheses: by inlier count, by the truncated
+    // squared error (MSAC), by the negative log-likelihood of an
+    // inlier/outlier mixture (MLESAC), or by the MAGSAC++ loss, which
+    // marginalizes over the noise scale and takes the threshold as an
+    // upper bound. The iteration bound always uses the inlier ratio of
+    // the best model.
+    enum { SCORE_INLIERS = 0, SCORE_MSAC = 1, SCORE_MLESAC = 2, SCORE_MAGSAC = 3 };
+
+    CvModelEstimator2(int _modelPoints, CvSize _modelSize, int _maxBasicSolutions);
+    virtual ~CvModelEstimator2();
+
+    virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model )=0;
+    virtual bool runLMeDS( const CvMat* m1, const CvMat* m2, CvMat* model,
+                           CvMat* mask, double confidence=0.99, int maxIters=2000 );
+    virtual bool runRANSAC( const CvMat* m1, const CvMat* m2, CvMat* model,
+                            CvMat* mask, double threshold,
+                            double confidence=0.99, int maxIters=2000 );
+    virtual bool refine( const CvMat*, const CvMat*, CvMat*, int ) { return true; }
+    // Weighted least-squares fit on all the points (weights is CV_32FC1,
+    // one per point), used to polish MAGSAC++ models. Estimators that do
+    // not override it are not polished.
+    virtual bool fitWeighted( const CvMat*, const CvMat*, const CvMat*, CvMat* ) { return false; }
+    virtual void setSeed( int64 seed );
+
+    // Samples whose index set was already drawn in the same call are
+    // skipped without solving. Up to capacity distinct samples are
+    // remembered (0 disables the check, the default). duplicateSampleStats()
+    // reports how many were skipped over all estimators, and clears it if
+    // reset.
+    void setSampleCacheSize( int capacity );
+    static void duplicateSampleStats( int & nduplicates, bool reset = false );
+
+    // Draws every point of a sample from a different cell of a grid x grid
+    // grid over the second image, e.g. 8 (grid <= 1 turns it off, the
+    // default). The cells of a sample are weighted by their population.
+    // With stratifiedScoring, RANSAC scores each hypothesis on one point
+    // per cell before the full set.
+    void setBucketing( int grid, bool stratifiedScoring = false );
+
+    // Models that runRANSAC scores before drawing any sample, stacked
+    // like the output of runKernel (NULL clears them).
+    void setInitialModels( const CvMat* models );
+
+    void setScoring( int method );
+
+    // Stops scoring a hypothesis once it cannot beat the best one
+    // (BAILOUT_EXACT), or once its inliers so far make that unlikely
+    // (BAILOUT_PROBABILISTIC, which also does the exact test and shuffles
+    // the points once per runRANSAC call). Off by default.
+    enum { BAILOUT_NONE = 0, BAILOUT_EXACT = 1, BAILOUT_PROBABILISTIC = 2 };
+    void setBailOut( int mode );
+
+protected:
+    virtual void computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error ) = 0;
+    // Called once per run on the full point set, before any scoring, so
+    // estimators can precompute per-point terms. computeReprojError runs
+    // on several threads and must only read them.
+    virtual void prepareScoring( const CvMat*, const CvMat* ) {}
+    virtual int findInliers( const CvMat* m1, const CvMat* m2,
+                             const CvMat* model, CvMat* error,
+                             CvMat* mask, double threshold );
+    virtual int computeInlierBits( const CvMat* m1, const CvMat* m2,
+                                   const CvMat* model, CvMat* error,
+                                   uint64* bits, double threshold );
+    int findInlierBits( const CvMat* m1, const CvMat* m2,
+                        const CvMat* model, CvMat* error,
+                        uint64* bits, double threshold, double* cost = 0,
+                        double bestCost = DBL_MAX, int bestCount = 0 );
+    virtual bool getSubset( const CvMat* m1, const CvMat* m2,
+                            CvMat* ms1, CvMat* ms2, int maxAttempts=1000 );
+    virtual bool checkSubset( const CvMat* ms1, int count );
+    bool runExhaustive( const CvMat* m1, const CvMat* m2, CvMat* model,
+                        CvMat* mask, double threshold );
+    void buildBuckets( const CvMat* m2 );
+    void getStrata( std::vector<int>& strata );
+    void polishMAGSAC( const CvMat* m1, const CvMat* m2, CvMat* model, CvMat* err,
+                       uint64* bits, double threshold, double& cost, int& goodCount );
+    double computeMedian( const CvMat* m1, const CvMat* m2, const CvMat* model,
+                          CvMat* err, double bestMedian );
+
+    friend class CvLMeDSBody;
+    friend class CvRANSACBody;
+
+    void nextSample( int count, int* idx );
+
+    CvPhiloxRNG rng;
+    int modelPoints;
+    CvSize modelSize;
+    int maxBasicSolutions;
+    bool checkPartialSubsets;
+
+    std::vector<int> sampleIdx, sampleBlock;
+    int sampleBlockPos, sampleBlockCount;
+    int sampleCacheSize;
+    static int duplicateSamples;
+    int bucketGrid;
+    bool bucketScoring;
+    std::vector<int> pointBucket;
+    cv::Mat initialModels, workModels, workErr;
+    int scoring;
+    int bailOut;
+    // MAGSAC++ loss and weight over the squared residual, tabulated on
+    // [0, threshold^2). The loss rises to 1 at the threshold, the weight
+    // falls from 1 at zero residual.
+    std::vector<float> magsacLoss, magsacWeight;
+};
+
+#endif // _CV_MODEL_EST_H_
+
@@ -0,0 +1,650 @@
+/*  Copyright (c) 2013, Bo Li, prclibo@gmail.com
+    All rights reserved.
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in the
+          documentation and/or other materials provided with the distribution.
+        * Neither the name of the copyright holder nor the
+          names of its contributors may be used to endorse or promote products
+          derived from this software without specific prior written permission.
+    
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <opencv2/opencv.hpp>
+#include "three-point-vertical.hpp"
+#include "_modelest.h"
+
+/*
+ * 3-point relative pose with a known vertical direction, following 
+ * F. Fraundorfer, P. Tanskanen and M. Pollefeys, "A minimal case solution 
+ * to the calibrated relative pose problem for the case of two known 
+ * orientation angles", ECCV 2010. 
+ *
+ * Both frames are first rotated so that gravity is along the y axis. The 
+ * remaining rotation is a yaw about y, and each correspondence gives an 
+ * equation (alpha * cos + beta * sin + gamma) . t = 0 linear in t. Three 
+ * correspondences give M(yaw) t = 0, and with k = tan(yaw / 2) det M = 0 
+ * becomes a polynomial of degree 6 in k. 
+ */
+
+using namespace cv; 
+
+// Rotation that takes the gravity direction g to the y axis
+static Matx33d three_point_vertical_align(InputArray _g)
+{
+    Mat gm; 
+    _g.getMat().convertTo(gm, CV_64F); 
+    CV_Assert( gm.total() == 3 ); 
+    gm = gm.reshape(1, 3); 
+    Vec3d g(gm.at<double>(0), gm.at<double>(1), gm.at<double>(2)); 
+    g *= 1.0 / norm(g); 
+
+    Vec3d y(0, 1, 0); 
+    Vec3d axis = g.cross(y); 
+    double s = norm(axis), c = g.dot(y); 
+    if (s < DBL_EPSILON) 
+        return c > 0 ? Matx33d::eye() : Matx33d(1, 0, 0, 0, -1, 0, 0, 0, -1); 
+
+    Vec3d rvec = axis * (atan2(s, c) / s); 
+    Matx33d R; 
+    Rodrigues(rvec, R); 
+    return R; 
+}
+
+// Multiplies polynomials a (degree na) and b (degree nb), ascending order
+static void three_point_vertical_polymul(const double * a, int na, const double * b, int nb, double * c)
+{
+    for (int i = 0; i <= na + nb; i++) c[i] = 0; 
+    for (int i = 0; i <= na; i++)
+        for (int j = 0; j <= nb; j++)
+            c[i + j] += a[i] * b[j]; 
+}
+
+/*
+ * Solves M(yaw) t = 0, where row i of M has the coefficients 
+ * abg[i][j] = (alpha, beta, gamma) for t_j. 
+ */
+static int three_point_vertical_solve(double abg[3][3][3], double * yaws, Vec3d * ts)
+{
+    // With cos = (1 - k^2) / (1 + k^2) and sin = 2k / (1 + k^2), each 
+    // entry times (1 + k^2) is a quadratic in k. 
+    double p[3][3][3]; 
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+        {
+            double alpha = abg[i][j][0], beta = abg[i][j][1], gamma = abg[i][j][2]; 
+            p[i][j][0] = alpha + gamma; 
+            p[i][j][1] = 2 * beta; 
+            p[i][j][2] = gamma - alpha; 
+        }
+
+    double det[7] = {0}; 
+    static const int perms[6][3] = {{0, 1, 2}, {1, 2, 0}, {2, 0, 1}, {0, 2, 1}, {1, 0, 2}, {2, 1, 0}}; 
+    for (int k = 0; k < 6; k++)
+    {
+        double tmp[5], prod[7]; 
+        three_point_vertical_polymul(p[0][perms[k][0]], 2, p[1][perms[k][1]], 2, tmp); 
+        three_point_vertical_polymul(tmp, 4, p[2][perms[k][2]], 2, prod); 
+        double sign = k < 3 ? 1 : -1; 
+        for (int i = 0; i < 7; i++) det[i] += sign * prod[i]; 
+    }
+
+    // Drop vanishing leading coefficients before solving
+    double scale = 0; 
+    for (int i = 0; i < 7; i++) scale = std::max(scale, fabs(det[i])); 
+    if (scale == 0) return 0; 
+    int degree = 6; 
+    while (degree > 0 && fabs(det[degree]) < scale * 1e-12) degree--; 
+    if (degree == 0) return 0; 
+
+    Mat coeffs(1, degree + 1, CV_64F, det), roots; 
+    solvePoly(coeffs, roots); 
+
+    int count = 0; 
+    for (int r = 0; r < degree; r++)
+    {
+        Vec2d root = roots.at<Vec2d>(r); 
+        if (fabs(root[1]) > 1e-8 * (1 + fabs(root[0]))) continue; 
+        double k = root[0]; 
+        double c = (1 - k * k) / (1 + k * k), s = 2 * k / (1 + k * k); 
+
+        Vec3d rows[3]; 
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                rows[i][j] = abg[i][j][0] * c + abg[i][j][1] * s + abg[i][j][2]; 
+
+        // t is the null vector of M, take the best conditioned cross product
+        Vec3d t = rows[0].cross(rows[1]), t2 = rows[0].cross(rows[2]), t3 = rows[1].cross(rows[2]); 
+        if (norm(t2) > norm(t)) t = t2; 
+        if (norm(t3) > norm(t)) t = t3; 
+        if (norm(t) < DBL_EPSILON) continue; 
+
+        yaws[count] = atan2(s, c); 
+        ts[count] = t * (1.0 / norm(t)); 
+        count++; 
+    }
+    return count; 
+}
+
+/*
+ * Solves the yaw and the translation from 3 gravity aligned bearings. 
+ * Returns the number of solutions, the translations are only defined 
+ * up to sign. 
+ */
+static int three_point_vertical_kernel(const Vec3d * b1, const Vec3d * b2, double * yaws, Vec3d * ts)
+{
+    // For each point, the coefficients of (tx, ty, tz) are 
+    // alpha * cos(yaw) + beta * sin(yaw) + gamma. 
+    double abg[3][3][3]; 
+    for (int i = 0; i < 3; i++)
+    {
+        double u1 = b1[i][0], v1 = b1[i][1], w1 = b1[i][2]; 
+        double u2 = b2[i][0], v2 = b2[i][1], w2 = b2[i][2]; 
+        double row[3][3] = {{-v2 * w1, v2 * u1, w2 * v1}, 
+                            {u2 * w1 - w2 * u1, -(u2 * u1 + w2 * w1), 0}, 
+                            {v2 * u1, v2 * w1, -u2 * v1}}; 
+        memcpy(abg[i], row, sizeof(row)); 
+    }
+    return three_point_vertical_solve(abg, yaws, ts); 
+}
+
+// Normalized image point as a gravity aligned bearing
+static inline Vec3d three_point_vertical_bearing(const Matx33d & G, double x, double y)
+{
+    return G * Vec3d(x, y, 1.0); 
+}
+
+// Pose in the original frames from a yaw and a translation in the 
+// aligned frames, as a 1x6 (rvec, tvec) model. 
+static void three_point_vertical_pose(const Matx33d & G1, const Matx33d & G2, 
+                                      double yaw, const Vec3d & t, double * rt)
+{
+    double c = cos(yaw), s = sin(yaw); 
+    Matx33d Ry(c, 0, s, 0, 1, 0, -s, 0, c); 
+    Matx33d R = G2.t() * Ry * G1; 
+    Vec3d rvec; 
+    Rodrigues(R, rvec); 
+    Vec3d tvec = G2.t() * t; 
+    for (int k = 0; k < 3; k++)
+    {
+        rt[k] = rvec[k]; 
+        rt[k + 3] = tvec[k]; 
+    }
+}
+
+void three_point_vertical(cv::InputArray _points1, cv::InputArray _points2, 
+                cv::InputArray gravity1, cv::InputArray gravity2, 
+                double focal, cv::Point2d pp, 
+                cv::OutputArray _rvecs, cv::OutputArray _tvecs)
+{
+    Mat points1, points2; 
+	_points1.getMat().copyTo(points1); 
+	_points2.getMat().copyTo(points2); 
+
+	int npoints = points1.checkVector(2);
+    CV_Assert( npoints == 3 && points2.checkVector(2) == npoints &&
+				              points1.type() == points2.type());
+
+	if (points1.channels() > 1)
+	{
+		points1 = points1.reshape(1, npoints); 
+		points2 = points2.reshape(1, npoints); 
+	}
+	points1.convertTo(points1, CV_64F); 
+	points2.convertTo(points2, CV_64F); 
+
+	points1.col(0) = (points1.col(0) - pp.x) / focal; 
+	points2.col(0) = (points2.col(0) - pp.x) / focal; 
+	points1.col(1) = (points1.col(1) - pp.y) / focal; 
+	points2.col(1) = (points2.col(1) - pp.y) / focal; 
+
+    Matx33d G1 = three_point_vertical_align(gravity1); 
+    Matx33d G2 = three_point_vertical_align(gravity2); 
+
+    Vec3d b1[3], b2[3]; 
+    for (int i = 0; i < 3; i++)
+    {
+        b1[i] = three_point_vertical_bearing(G1, points1.at<double>(i, 0), points1.at<double>(i, 1)); 
+        b2[i] = three_point_vertical_bearing(G2, points2.at<double>(i, 0), points2.at<double>(i, 1)); 
+    }
+
+    double yaws[6]; 
+    Vec3d ts[6]; 
+    int n = three_point_vertical_kernel(b1, b2, yaws, ts); 
+
+    _rvecs.create(3, n * 2, CV_64F, -1, true); 
+    _tvecs.create(3, n * 2, CV_64F, -1, true); 
+    Mat rvecs = _rvecs.getMat(), tvecs = _tvecs.getMat(); 
+    for (int i = 0; i < n; i++)
+    {
+        double rt[6]; 
+        three_point_vertical_pose(G1, G2, yaws[i], ts[i], rt); 
+        for (int k = 0; k < 3; k++)
+        {
+            rvecs.at<double>(k, i * 2) = rvecs.at<double>(k, i * 2 + 1) = rt[k]; 
+            tvecs.at<double>(k, i * 2) = rt[k + 3]; 
+            tvecs.at<double>(k, i * 2 + 1) = -rt[k + 3]; 
+        }
+    }
+}
+
+
+class CvThreePointVerticalEstimator : public CvModelEstimator2
+{
+    Matx33d G1, G2; 
+public:
+    CvThreePointVerticalEstimator( const Matx33d & _G1, const Matx33d & _G2 ); 
+    virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model ); 
+protected: 
+    virtual void computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error );
+}; 
+
+CvThreePointVerticalEstimator::CvThreePointVerticalEstimator( const Matx33d & _G1, const Matx33d & _G2 )
+: CvModelEstimator2( 3, cvSize(6, 1), 6 ), 
+  G1( _G1 ), G2( _G2 ) 
+{
+}
+
+// q1 and q2 are 1 row x n col x 2 channels of normalized points. 
+// Only one sign of t is returned per yaw, t and -t have the same error. 
+int CvThreePointVerticalEstimator::runKernel( const CvMat* q1, const CvMat* q2, CvMat* _rvec_tvec )
+{
+    const double * x1 = q1->data.db; 
+    const double * x2 = q2->data.db; 
+    Vec3d b1[3], b2[3]; 
+    for (int i = 0; i < 3; i++)
+    {
+        b1[i] = three_point_vertical_bearing(G1, x1[i * 2], x1[i * 2 + 1]); 
+        b2[i] = three_point_vertical_bearing(G2, x2[i * 2], x2[i * 2 + 1]); 
+    }
+
+    double yaws[6]; 
+    Vec3d ts[6]; 
+    int n = three_point_vertical_kernel(b1, b2, yaws, ts); 
+    for (int i = 0; i < n; i++)
+        three_point_vertical_pose(G1, G2, yaws[i], ts[i], _rvec_tvec->data.db + i * 6); 
+    return n; 
+}
+
+/*
+ * Sampson error of a 1x6 (rvec, tvec) model. x1 and x2 hold the 
+ * normalized points every cn doubles, so that the point part of wider 
+ * elements can be scored too. 
+ */
+static void three_point_vertical_sampson(const double * rt, const double * x1, const double * x2, 
+                                         int cn, int count, float * err)
+{
+    Matx33d R; 
+    Rodrigues(Vec3d(rt[0], rt[1], rt[2]), R); 
+    Matx33d tskew(0, -rt[5], rt[4], rt[5], 0, -rt[3], -rt[4], rt[3], 0); 
+    Matx33d E = tskew * R; 
+
+    for (int i = 0; i < count; i++)
+    {
+        Vec3d p1(x1[i * cn], x1[i * cn + 1], 1.0); 
+        Vec3d p2(x2[i * cn], x2[i * cn + 1], 1.0); 
+        Vec3d Ex1 = E * p1; 
+        Vec3d Etx2 = E.t() * p2; 
+        double x2tEx1 = p2.dot(Ex1); 
+        double a = Ex1[0] * Ex1[0] + Ex1[1] * Ex1[1]; 
+        double b = Etx2[0] * Etx2[0] + Etx2[1] * Etx2[1]; 
+        err[i] = (float)(x2tEx1 * x2tEx1 / (a + b)); 
+    }
+}
+
+// Sampson error, m1 and m2 are 1 row x n col x 2 channels, 
+// error is CV_32FC1. 
+void CvThreePointVerticalEstimator::computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error )
+{
+    three_point_vertical_sampson(model->data.db, m1->data.db, m2->data.db, 2, 
+                                 m1->rows * m1->cols, error->data.fl); 
+}
+
+/*
+ * t and -t have the same Sampson error, so RANSAC only scores one of 
+ * them. The sign is resolved by a cheirality vote: each inlier is 
+ * triangulated with +t, and it votes for +t if its depths in both 
+ * cameras are positive, or for -t if both are negative. 
+ * Returns true if -t wins. 
+ */
+static bool three_point_vertical_flip_translation(const Mat & points1, const Mat & points2, const Mat & mask, 
+                                                  const double * rt)
+{
+    Matx33d R; 
+    Rodrigues(Vec3d(rt[0], rt[1], rt[2]), R); 
+    Vec3d t(rt[3], rt[4], rt[5]); 
+
+    const Vec2d * x1s = points1.ptr<Vec2d>(); 
+    const Vec2d * x2s = points2.ptr<Vec2d>(); 
+    const uchar * m = mask.ptr<uchar>(); 
+    int n = points1.checkVector(2); 
+
+    int positive = 0, negative = 0; 
+    for (int i = 0; i < n; i++)
+    {
+        if (!m[i]) continue; 
+        Vec3d x1(x1s[i][0], x1s[i][1], 1.0); 
+        Vec3d x2(x2s[i][0], x2s[i][1], 1.0); 
+        Vec3d Rx1 = R * x1; 
+
+        // From d2 * x2 = d1 * R * x1 + t 
+        double d1 = -x2.cross(t).dot(x2.cross(Rx1)); 
+        double d2 = Rx1.cross(t).dot(Rx1.cross(x2)); 
+        if (d1 > 0 && d2 > 0) positive++; 
+        else if (d1 < 0 && d2 < 0) negative++; 
+    }
+    return negative > positive; 
+}
+
+void findPose3pt_vertical(cv::InputArray _points1, cv::InputArray _points2, 
+              cv::InputArray gravity1, cv::InputArray gravity2, 
+              double focal, cv::Point2d pp, 
+              cv::OutputArray _rvecs, cv::OutputArray _tvecs, 
+              int method, double prob, double threshold, OutputArray _mask) 
+{
+	Mat points1, points2; 
+	_points1.getMat().copyTo(points1); 
+	_points2.getMat().copyTo(points2); 
+
+	int npoints = points1.checkVector(2);
+    CV_Assert( npoints >= 3 && points2.checkVector(2) == npoints &&
+				              points1.type() == points2.type());
+
+    if (npoints == 3)
+    {
+        three_point_vertical(_points1, _points2, gravity1, gravity2, focal, pp, _rvecs, _tvecs); 
+        if (_mask.needed())
+        {
+            _mask.create(1, npoints, CV_8U, -1, true); 
+            _mask.getMat().setTo(true); 
+        }
+        return; 
+    }
+
+	if (points1.channels() > 1)
+	{
+		points1 = points1.reshape(1, npoints); 
+		points2 = points2.reshape(1, npoints); 
+	}
+	points1.convertTo(points1, CV_64F); 
+	points2.convertTo(points2, CV_64F); 
+
+	points1.col(0) = (points1.col(0) - pp.x) / focal; 
+	points2.col(0) = (points2.col(0) - pp.x) / focal; 
+	points1.col(1) = (points1.col(1) - pp.y) / focal; 
+	points2.col(1) = (points2.col(1) - pp.y) / focal; 
+	
+	// Reshape data to fit opencv ransac function
+	points1 = points1.reshape(2, 1); 
+	points2 = points2.reshape(2, 1); 
+
+	Mat rvec_tvec(1, 6, CV_64F); 
+    CvThreePointVerticalEstimator estimator(three_point_vertical_align(gravity1), 
+                                            three_point_vertical_align(gravity2)); 
+
+	CvMat p1 = points1; 
+	CvMat p2 = points2; 
+	CvMat _rvec_tvec = rvec_tvec; 
+	CvMat* tempMask = cvCreateMat(1, npoints, CV_8U); 
+	
+	threshold /= focal; 
+    if (method == CV_RANSAC)
+	{
+		estimator.runRANSAC(&p1, &p2, &_rvec_tvec, tempMask, threshold, prob); 
+	}
+	else
+	{
+		estimator.runLMeDS(&p1, &p2, &_rvec_tvec, tempMask, prob); 
+	}
+
+    if (_mask.needed())
+    {
+    	_mask.create(1, npoints, CV_8U, -1, true); 
+    	Mat mask = _mask.getMat(); 
+    	Mat(tempMask).copyTo(mask); 
+    }
+
+    // The cheirality-consistent sign of tvec comes first
+    Mat rvec = rvec_tvec.colRange(0, 3).t() * 1.0; 
+    Mat tvec = rvec_tvec.colRange(3, 6).t() * 1.0; 
+    if (three_point_vertical_flip_translation(points1, points2, Mat(tempMask), rvec_tvec.ptr<double>())) 
+        tvec = -tvec; 
+    cvReleaseMat(&tempMask); 
+
+    _rvecs.create(3, 2, CV_64F, -1, true); 
+    _tvecs.create(3, 2, CV_64F, -1, true); 
+
+    _rvecs.getMat().col(0) = rvec * 1.0; 
+    _tvecs.getMat().col(0) = tvec * 1.0; 
+
+    _rvecs.getMat().col(1) = rvec * 1.0; 
+    _tvecs.getMat().col(1) = -tvec * 1.0; 
+}
+
+/*
+ * Coefficients abg[j] = (alpha, beta, gamma) of t_j for a constraint 
+ * sum C_kl E'_kl = 0 on the gravity aligned E' = [t]x Ry, using 
+ * Ry = cos * Rc + sin * Rs + R1. 
+ */
+static void three_point_vertical_coeffs(const Matx33d & C, double abg[3][3])
+{
+    static const Matx33d B[3] = {Matx33d(1, 0, 0, 0, 0, 0, 0, 0, 1), 
+                                 Matx33d(0, 0, 1, 0, 0, 0, -1, 0, 0), 
+                                 Matx33d(0, 0, 0, 0, 1, 0, 0, 0, 0)}; 
+    for (int j = 0; j < 3; j++)
+    {
+        Vec3d e(0, 0, 0); 
+        e[j] = 1; 
+        Matx33d ex(0, -e[2], e[1], e[2], 0, -e[0], -e[1], e[0], 0); 
+        for (int b = 0; b < 3; b++)
+            abg[j][b] = C.dot(ex * B[b]); 
+    }
+}
+
+/*
+ * 1 affine correspondence with a known vertical direction. The point 
+ * and its affine frame A give x2' E x1 = 0 and 
+ * (E' x2)_(1:2) + A' (E x1)_(1:2) = 0, three equations linear in E. 
+ * Written as sum C_kl E_kl = 0 with E = G2' E' G1, each becomes a 
+ * row of M(yaw) with C' = G2 C G1'. 
+ * p1 = (x1, y1, a11, a12) and p2 = (x2, y2, a21, a22). 
+ */
+static int one_ac_vertical_kernel(const Matx33d & G1, const Matx33d & G2, 
+                                  const double * p1, const double * p2, double * yaws, Vec3d * ts)
+{
+    Vec3d x1(p1[0], p1[1], 1.0), x2(p2[0], p2[1], 1.0); 
+    double A[2][2] = {{p1[2], p1[3]}, {p2[2], p2[3]}}; 
+
+    Matx33d C[3]; 
+    C[0] = x2 * x1.t(); 
+    for (int k = 0; k < 2; k++)
+    {
+        Matx33d & Ck = C[k + 1]; 
+        Ck = Matx33d::zeros(); 
+        for (int i = 0; i < 3; i++) Ck(i, k) += x2[i]; 
+        for (int m = 0; m < 2; m++)
+            for (int j = 0; j < 3; j++)
+                Ck(m, j) += A[m][k] * x1[j]; 
+    }
+
+    double abg[3][3][3]; 
+    for (int i = 0; i < 3; i++)
+        three_point_vertical_coeffs(G2 * C[i] * G1.t(), abg[i]); 
+    return three_point_vertical_solve(abg, yaws, ts); 
+}
+
+class CvOneACVerticalEstimator : public CvModelEstimator2
+{
+    Matx33d G1, G2; 
+public:
+    CvOneACVerticalEstimator( const Matx33d & _G1, const Matx33d & _G2 ); 
+    virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model ); 
+protected: 
+    virtual void computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error );
+    virtual bool checkSubset( const CvMat* ms1, int count ); 
+}; 
+
+CvOneACVerticalEstimator::CvOneACVerticalEstimator( const Matx33d & _G1, const Matx33d & _G2 )
+: CvModelEstimator2( 1, cvSize(6, 1), 6 ), 
+  G1( _G1 ), G2( _G2 ) 
+{
+}
+
+// m1 and m2 are 1 row x n col x 4 channels, the normalized point 
+// followed by one row of the affine frame. 
+int CvOneACVerticalEstimator::runKernel( const CvMat* m1, const CvMat* m2, CvMat* _rvec_tvec )
+{
+    double yaws[6]; 
+    Vec3d ts[6]; 
+    int n = one_ac_vertical_kernel(G1, G2, m1->data.db, m2->data.db, yaws, ts); 
+    for (int i = 0; i < n; i++)
+        three_point_vertical_pose(G1, G2, yaws[i], ts[i], _rvec_tvec->data.db + i * 6); 
+    return n; 
+}
+
+// Sampson error of the point part, error is CV_32FC1. 
+void CvOneACVerticalEstimator::computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error )
+{
+    three_point_vertical_sampson(model->data.db, m1->data.db, m2->data.db, 4, 
+                                 m1->rows * m1->cols, error->data.fl); 
+}
+
+// A single correspondence is always a valid sample, and the base class 
+// check expects 2-channel points. 
+bool CvOneACVerticalEstimator::checkSubset( const CvMat*, int )
+{
+    return true; 
+}
+
+void findPose1AC_vertical(cv::InputArray _points1, cv::InputArray _points2, cv::InputArray _affines, 
+              cv::InputArray gravity1, cv::InputArray gravity2, 
+              double focal, cv::Point2d pp, 
+              cv::OutputArray _rvecs, cv::OutputArray _tvecs, 
+              int method, double prob, double threshold, OutputArray _mask) 
+{
+	Mat points1, points2, affines; 
+	_points1.getMat().copyTo(points1); 
+	_points2.getMat().copyTo(points2); 
+	_affines.getMat().copyTo(affines); 
+
+	int npoints = points1.checkVector(2);
+    CV_Assert( npoints >= 1 && points2.checkVector(2) == npoints &&
+				              points1.type() == points2.type() && 
+                              affines.checkVector(4) == npoints );
+
+	if (points1.channels() > 1)
+	{
+		points1 = points1.reshape(1, npoints); 
+		points2 = points2.reshape(1, npoints); 
+	}
+    affines = affines.reshape(1, npoints); 
+	points1.convertTo(points1, CV_64F); 
+	points2.convertTo(points2, CV_64F); 
+    affines.convertTo(affines, CV_64F); 
+
+	points1.col(0) = (points1.col(0) - pp.x) / focal; 
+	points2.col(0) = (points2.col(0) - pp.x) / focal; 
+	points1.col(1) = (points1.col(1) - pp.y) / focal; 
+	points2.col(1) = (points2.col(1) - pp.y) / focal; 
+
+    // The affine frames are unchanged by the normalization. Pack the 
+    // first row of each frame with points1 and the second with points2. 
+    Mat q1, q2; 
+    Mat cols1[] = {points1, affines.colRange(0, 2)}; 
+    Mat cols2[] = {points2, affines.colRange(2, 4)}; 
+    hconcat(cols1, 2, q1); 
+    hconcat(cols2, 2, q2); 
+    q1 = q1.reshape(4, 1); 
+    q2 = q2.reshape(4, 1); 
+	points1 = points1.reshape(2, 1); 
+	points2 = points2.reshape(2, 1); 
+
+    Matx33d G1 = three_point_vertical_align(gravity1); 
+    Matx33d G2 = three_point_vertical_align(gravity2); 
+    CvOneACVerticalEstimator estimator(G1, G2); 
+
+	CvMat p1 = q1; 
+	CvMat p2 = q2; 
+
+    if (npoints == 1)
+    {
+        Mat rvec_tvec(6, 6, CV_64F); 
+        CvMat _rvec_tvec = rvec_tvec; 
+        int n = estimator.runKernel(&p1, &p2, &_rvec_tvec); 
+
+        _rvecs.create(3, n * 2, CV_64F, -1, true); 
+        _tvecs.create(3, n * 2, CV_64F, -1, true); 
+        Mat rvecs = _rvecs.getMat(), tvecs = _tvecs.getMat(); 
+        for (int i = 0; i < n; i++)
+        {
+            const double * rt = rvec_tvec.ptr<double>(i); 
+            for (int k = 0; k < 3; k++)
+            {
+                rvecs.at<double>(k, i * 2) = rvecs.at<double>(k, i * 2 + 1) = rt[k]; 
+                tvecs.at<double>(k, i * 2) = rt[k + 3]; 
+                tvecs.at<double>(k, i * 2 + 1) = -rt[k + 3]; 
+            }
+        }
+        if (_mask.needed())
+        {
+            _mask.create(1, npoints, CV_8U, -1, true); 
+            _mask.getMat().setTo(true); 
+        }
+        return; 
+    }
+
+	Mat rvec_tvec(1, 6, CV_64F); 
+	CvMat _rvec_tvec = rvec_tvec; 
+	CvMat* tempMask = cvCreateMat(1, npoints, CV_8U); 
+	
+	threshold /= focal; 
+    if (method == CV_RANSAC)
+	{
+		estimator.runRANSAC(&p1, &p2, &_rvec_tvec, tempMask, threshold, prob); 
+	}
+	else
+	{
+		estimator.runLMeDS(&p1, &p2, &_rvec_tvec, tempMask, prob); 
+	}
+
+    if (_mask.needed())
+    {
+    	_mask.create(1, npoints, CV_8U, -1, true); 
+    	Mat mask = _mask.getMat(); 
+    	Mat(tempMask).copyTo(mask); 
+    }
+
+    // The cheirality-consistent sign of tvec comes first
+    Mat rvec = rvec_tvec.colRange(0, 3).t() * 1.0; 
+    Mat tvec = rvec_tvec.colRange(3, 6).t() * 1.0; 
+    if (three_point_vertical_flip_translation(points1, points2, Mat(tempMask), rvec_tvec.ptr<double>())) 
+        tvec = -tvec; 
+    cvReleaseMat(&tempMask); 
+
+    _rvecs.create(3, 2, CV_64F, -1, true); 
+    _tvecs.create(3, 2, CV_64F, -1, true); 
+
+    _rvecs.getMat().col(0) = rvec * 1.0; 
+    _tvecs.getMat().col(0) = tvec * 1.0; 
+
+    _rvecs.getMat().col(1) = rvec * 1.0; 
+    _tvecs.getMat().col(1) = -tvec * 1.0; 
+}
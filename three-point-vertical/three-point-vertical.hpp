@@ -0,0 +1,54 @@
+/*  Copyright (c) 2013, Bo Li, prclibo@gmail.com
+    All rights reserved.
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in the
+          documentation and/or other materials provided with the distribution.
+        * Neither the name of the copyright holder nor the
+          names of its contributors may be used to endorse or promote products
+          derived from this software without specific prior written permission.
+    
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef THREE_POINT_VERTICAL_HPP
+#define THREE_POINT_VERTICAL_HPP
+
+#include <opencv2/opencv.hpp>
+
+// gravity1 and gravity2 are the vertical direction (e.g. from an IMU) 
+// in the first and second camera frame, as 3-vectors. 
+void findPose3pt_vertical(cv::InputArray points1, cv::InputArray points2, 
+              cv::InputArray gravity1, cv::InputArray gravity2, 
+              double focal, cv::Point2d pp, 
+              cv::OutputArray rvecs, cv::OutputArray tvecs, 
+              int method, double prob, double threshold, cv::OutputArray _mask); 
+
+void three_point_vertical(cv::InputArray points1, cv::InputArray points2, 
+                cv::InputArray gravity1, cv::InputArray gravity2, 
+                double focal, cv::Point2d pp, 
+                cv::OutputArray rvecs, cv::OutputArray tvecs); 
+
+// 1 affine correspondence per sample. affines is n x 4 (or a vector of 
+// Vec4d) holding the local affine frames (a11, a12, a21, a22) that map 
+// pixel offsets around points1 to pixel offsets around points2. 
+void findPose1AC_vertical(cv::InputArray points1, cv::InputArray points2, cv::InputArray affines, 
+              cv::InputArray gravity1, cv::InputArray gravity2, 
+              double focal, cv::Point2d pp, 
+              cv::OutputArray rvecs, cv::OutputArray tvecs, 
+              int method, double prob, double threshold, cv::OutputArray _mask); 
+
+#endif
@@ -0,0 +1,1331 @@
+/*M///////////////////////////////////////////////////////////////////////////////////////
+//
+//  IMPORTANT: READ BEFORE DOWNLOADING, COPYING, INSTALLING OR USING.
+//
+//  By downloading, copying, installing or using the software you agree to this license.
+//  If you do not agree to this license, do not download, install,
+//  copy or use the software.
+//
+//
+//                        Intel License Agreement
+//                For Open Source Computer Vision Library
+//
+// Copyright (C) 2000, Intel Corporation, all rights reserved.
+// Third party copyrights are property of their respective owners.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+//   * Redistribution's of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+//   * Redistribution's in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+//   * The name of Intel Corporation may not be used to endorse or promote products
+//     derived from this software without specific prior written permission.
+//
+// This software is provided by the copyright holders and contributors "as is" and
+// any express or implied warranties, including, but not limited to, the implied
+// warranties of merchantability and fitness for a particular purpose are disclaimed.
+// In no event shall the Intel Corporation or contributors be liable for any direct,
+// indirect, incidental, special, exemplary, or consequential damages
+// (including, but not limited to, procurement of substitute goods or services;
+// loss of use, data, or profits; or business interruption) however caused
+// and on any theory of liability, whether in contract, strict liability,
+// or tort (including negligence or otherwise) arising in any way out of
+// the use of this software, even if advised of the possibility of such damage.
+//
+//M*/
+
+#include "precomp.hpp"
+#include "_modelest.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <iostream>
+
+using namespace std;
+
+
+CvModelEstimator2::CvModelEstimator2(int _modelPoints, CvSize _modelSize, int _maxBasicSolutions)
+{
+    modelPoints = _modelPoints;
+    modelSize = _modelSize;
+    maxBasicSolutions = _maxBasicSolutions;
+    checkPartialSubsets = true;
+    rng = CvPhiloxRNG((uint64)-1);
+    sampleBlockPos = sampleBlockCount = 0;
+    sampleCacheSize = 0;
+    bucketGrid = 0;
+    bucketScoring = false;
+    scoring = SCORE_INLIERS;
+    bailOut = BAILOUT_NONE;
+}
+
+CvModelEstimator2::~CvModelEstimator2()
+{
+}
+
+void CvModelEstimator2::setSeed( int64 seed )
+{
+    rng = CvPhiloxRNG((uint64)seed);
+    sampleBlockCount = 0;
+}
+
+
+// Philox4x32-10, J. Salmon et al., "Parallel random numbers: as easy as
+// 1, 2, 3", SC 2011
+void CvPhiloxRNG::generate()
+{
+    unsigned c[4] = { ctr[0], ctr[1], ctr[2], ctr[3] }, k[2] = { key[0], key[1] };
+    for( int r = 0; r < 10; r++ )
+    {
+        uint64 p0 = (uint64)0xD2511F53u*c[0], p1 = (uint64)0xCD9E8D57u*c[2];
+        unsigned n0 = (unsigned)(p1 >> 32) ^ c[1] ^ k[0];
+        unsigned n2 = (unsigned)(p0 >> 32) ^ c[3] ^ k[1];
+        c[0] = n0; c[1] = (unsigned)p1; c[2] = n2; c[3] = (unsigned)p0;
+        k[0] += 0x9E3779B9u; k[1] += 0xBB67AE85u;
+    }
+    for( int i = 0; i < 4; i++ )
+        out[i] = c[i];
+    if( ++ctr[0] == 0 )
+        ctr[1]++;
+    pos = 0;
+}
+
+// Unbiased integer in [0, n), D. Lemire's multiply and reject
+unsigned CvPhiloxRNG::uniform( unsigned n )
+{
+    uint64 m = (uint64)next()*n;
+    unsigned l = (unsigned)m;
+    if( l < n )
+    {
+        unsigned t = (0u - n) % n;
+        while( l < t )
+        {
+            m = (uint64)next()*n;
+            l = (unsigned)m;
+        }
+    }
+    return (unsigned)(m >> 32);
+}
+
+void CvModelEstimator2::setSampleCacheSize( int capacity )
+{
+    sampleCacheSize = capacity;
+}
+
+void CvModelEstimator2::setInitialModels( const CvMat* models )
+{
+    if( !models )
+    {
+        initialModels.release();
+        return;
+    }
+    CV_Assert( CV_MAT_TYPE(models->type) == CV_64FC1 && models->cols == modelSize.width &&
+               models->rows % modelSize.height == 0 );
+    cv::Mat(models).copyTo(initialModels);
+}
+
+// Lower incomplete gamma function by its power series, for the small
+// arguments of the MAGSAC++ tables
+static double icvLowerGamma( double s, double x )
+{
+    double term = 1./s, sum = term;
+    for( int n = 1; n < 200 && term > sum*DBL_EPSILON; n++ )
+    {
+        term *= x/(s + n);
+        sum += term;
+    }
+    return pow(x, s)*exp(-x)*sum;
+}
+
+// MAGSAC++ (D. Barath et al., "MAGSAC++, a fast, reliable and accurate
+// robust estimator", CVPR 2020) with 4 degrees of freedom for a
+// correspondence and k = 3.64, the 0.99 quantile of the chi
+// distribution. With x = r^2/(2 sigma_max^2), up to a constant factor
+//   loss(x)   = gamma(5/2, x) + x*(Gamma(3/2, x) - Gamma(3/2, k^2/2))
+//   weight(x) = Gamma(3/2, x) - Gamma(3/2, k^2/2)
+// and entry j of the tables is at r^2 = j/N*threshold^2.
+static void icvMAGSACTables( std::vector<float>& loss, std::vector<float>& weight )
+{
+    const int N = 1024;
+    const double k = 3.64, xk = k*k/2;
+    const double Gamma32 = 0.5*sqrt(CV_PI);
+    double upperK = Gamma32 - icvLowerGamma( 1.5, xk );
+    double lossK = icvLowerGamma( 2.5, xk ), weight0 = Gamma32 - upperK;
+
+    loss.resize( N );
+    weight.resize( N );
+    for( int j = 0; j < N; j++ )
+    {
+        double x = xk*j/N, upper = Gamma32 - icvLowerGamma( 1.5, x ) - upperK;
+        loss[j] = (float)((icvLowerGamma( 2.5, x ) + x*upper)/lossK);
+        weight[j] = (float)(upper/weight0);
+    }
+}
+
+void CvModelEstimator2::setScoring( int method )
+{
+    CV_Assert( method == SCORE_INLIERS || method == SCORE_MSAC ||
+               method == SCORE_MLESAC || method == SCORE_MAGSAC );
+    scoring = method;
+    if( scoring == SCORE_MAGSAC && magsacLoss.empty() )
+        icvMAGSACTables( magsacLoss, magsacWeight );
+}
+
+void CvModelEstimator2::setBailOut( int mode )
+{
+    CV_Assert( mode == BAILOUT_NONE || mode == BAILOUT_EXACT || mode == BAILOUT_PROBABILISTIC );
+    bailOut = mode;
+}
+
+void CvModelEstimator2::setBucketing( int grid, bool stratifiedScoring )
+{
+    bucketGrid = grid;
+    bucketScoring = stratifiedScoring;
+}
+
+int CvModelEstimator2::duplicateSamples = 0;
+
+void CvModelEstimator2::duplicateSampleStats( int & nduplicates, bool reset )
+{
+    nduplicates = duplicateSamples;
+    if( reset )
+        CV_XADD(&duplicateSamples, -nduplicates);
+}
+
+
+// Set of the sorted index tuples of the samples drawn so far, with
+// open addressing. Once capacity tuples are stored, new ones are no
+// longer remembered. The slots are allocated on the first insert.
+class CvSampleCache
+{
+public:
+    CvSampleCache( int _capacity, int _k ) : capacity(_capacity), k(_k), size(0)
+    {
+        nslots = 16;
+        while( nslots < capacity*2 )
+            nslots *= 2;
+    }
+
+    // returns false if the same subset was inserted before
+    bool insert( const int* idx )
+    {
+        if( capacity <= 0 )
+            return true;
+        if( slots.empty() )
+            slots.assign( nslots*k, -1 );
+
+        cv::AutoBuffer<int> _t(k);
+        int* t = _t;
+        std::copy( idx, idx + k, t );
+        std::sort( t, t + k );
+
+        unsigned h = 2166136261u;
+        for( int i = 0; i < k; i++ )
+            h = (h ^ (unsigned)t[i])*16777619u;
+
+        for( int slot = h & (nslots - 1);; slot = (slot + 1) & (nslots - 1) )
+        {
+            int* s = &slots[slot*k];
+            if( s[0] < 0 )
+            {
+                if( size < capacity )
+                {
+                    std::copy( t, t + k, s );
+                    size++;
+                }
+                return true;
+            }
+            if( std::equal( t, t + k, s ) )
+                return false;
+        }
+    }
+
+private:
+    int capacity, k, size, nslots;
+    std::vector<int> slots;
+};
+
+
+int CvModelEstimator2::findInliers( const CvMat* m1, const CvMat* m2,
+                                    const CvMat* model, CvMat* _err,
+                                    CvMat* _mask, double threshold )
+{
+    int i, count = _err->rows*_err->cols, goodCount = 0;
+    const float* err = _err->data.fl;
+    uchar* mask = _mask->data.ptr;
+
+    computeReprojError( m1, m2, model, _err );
+    threshold *= threshold;
+    for( i = 0; i < count; i++ )
+        goodCount += mask[i] = err[i] <= threshold;
+    return goodCount;
+}
+
+
+static inline int icvPopcount64( uint64 x )
+{
+#if defined __GNUC__
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (int)((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// MLESAC cost: Gaussian inliers (sigma = threshold/1.96), uniform outliers, EM on the mix
+static double icvMLESACCost( const float* err, int count, double t, int goodCount )
+{
+    const int emIters = 3;
+    double sigma2 = t/(1.96*1.96), k = -0.5/sigma2;
+    double pin0 = 1./(2*CV_PI*sigma2), pout = pin0*exp(k*t);
+    double gamma = MIN(MAX((double)goodCount/count, 0.01), 0.99);
+    int i, iter;
+
+    for( iter = 0; iter < emIters; iter++ )
+    {
+        double s = 0;
+        for( i = 0; i < count; i++ )
+        {
+            double pin = gamma*pin0*exp(k*err[i]);
+            s += pin/(pin + (1 - gamma)*pout);
+        }
+        gamma = MIN(MAX(s/count, 0.01), 0.99);
+    }
+
+    double cost = 0;
+    for( i = 0; i < count; i++ )
+        cost -= log(gamma*pin0*exp(k*err[i]) + (1 - gamma)*pout);
+    return cost;
+}
+
+// Points [start, end) of a 1 x n or n x 1 point or error array
+static void icvGetPointRange( const CvMat* m, CvMat* sub, int start, int end )
+{
+    if( m->rows == 1 )
+        cvGetCols( m, sub, start, end );
+    else
+        cvGetRows( m, sub, start, end );
+}
+
+// Errors of m1, m2 into err, and their inlier bits into bits[0], ...
+// (64 points per word). Returns the number of inliers. The default runs
+// computeReprojError and thresholds the errors in a second pass;
+// estimators with a cheap per-point error can do both in one.
+int CvModelEstimator2::computeInlierBits( const CvMat* m1, const CvMat* m2,
+                                          const CvMat* model, CvMat* _err,
+                                          uint64* bits, double threshold )
+{
+    int i, w, count = _err->rows*_err->cols, goodCount = 0;
+    const float* err = _err->data.fl;
+    float t = (float)(threshold*threshold);
+
+    computeReprojError( m1, m2, model, _err );
+    for( w = 0; w*64 < count; w++ )
+    {
+        int i0 = w*64, i1 = MIN(i0 + 64, count);
+        uint64 word = 0;
+        i = i0;
+#if CV_SSE2
+        if( USE_SSE2 )
+        {
+            __m128 t4 = _mm_set1_ps(t);
+            for( ; i <= i1 - 4; i += 4 )
+            {
+                uint64 m4 = (uint64)_mm_movemask_ps(_mm_cmple_ps(_mm_loadu_ps(err + i), t4));
+                word |= m4 << (i - i0);
+            }
+        }
+#endif
+        for( ; i < i1; i++ )
+            word |= (uint64)(err[i] <= t) << (i - i0);
+        bits[w] = word;
+        goodCount += icvPopcount64(word);
+    }
+    return goodCount;
+}
+
+// Same as findInliers, but the mask is a bitset with 64 correspondences
+// per word, (count + 63)/64 words. The errors and bits come from
+// computeInlierBits.
+//
+// If cost is given, it also gets the score of the model under the
+// current scoring method (lower is better). The MSAC and MAGSAC++ sums
+// are taken block by block, right after the block's errors, while they
+// are still in cache.
+//
+// With the bail-out on and a best model given (bestCost, and bestCount
+// for the probabilistic test), the errors are computed block by block
+// and scoring stops once the model cannot beat the best one: -1 is
+// returned and cost is set to DBL_MAX. Equal costs are never cut off.
+int CvModelEstimator2::findInlierBits( const CvMat* m1, const CvMat* m2,
+                                       const CvMat* model, CvMat* _err,
+                                       uint64* bits, double threshold, double* cost,
+                                       double bestCost, int bestCount )
+{
+    const int scoreBlock = 1024, bailOutBlock = 256;
+    const double bailOutZ = 2.58;
+    int i, count = _err->rows*_err->cols, goodCount = 0;
+    const float* err = _err->data.fl;
+    double truncated = 0, magsac = 0;
+
+    float t = (float)(threshold*threshold);
+    bool msac = cost && scoring == SCORE_MSAC;
+    const float* lossTab = cost && scoring == SCORE_MAGSAC ? &magsacLoss[0] : 0;
+    float lossScale = (float)magsacLoss.size()/t;
+    int lossLast = (int)magsacLoss.size() - 1;
+
+    // the MLESAC cost only exists once all the errors are known
+    bool bail = bailOut != BAILOUT_NONE && cost && bestCost < DBL_MAX && scoring != SCORE_MLESAC;
+    int block = bail ? bailOutBlock : msac || lossTab ? scoreBlock : count;
+    double eps = (double)bestCount/count;
+
+    for( int b0 = 0; b0 < count; b0 += block )
+    {
+        int b1 = MIN(b0 + block, count);
+        if( b1 - b0 == count )
+            goodCount += computeInlierBits( m1, m2, model, _err, bits, threshold );
+        else
+        {
+            CvMat s1, s2, serr;
+            icvGetPointRange( m1, &s1, b0, b1 );
+            icvGetPointRange( m2, &s2, b0, b1 );
+            icvGetPointRange( _err, &serr, b0, b1 );
+            goodCount += computeInlierBits( &s1, &s2, model, &serr, bits + b0/64, threshold );
+        }
+
+        if( msac )
+        {
+            float s = 0;
+            i = b0;
+#if CV_SSE2
+            if( USE_SSE2 )
+            {
+                __m128 t4 = _mm_set1_ps(t), s4 = _mm_setzero_ps();
+                for( ; i <= b1 - 4; i += 4 )
+                    s4 = _mm_add_ps(s4, _mm_min_ps(_mm_loadu_ps(err + i), t4));
+                float CV_DECL_ALIGNED(16) buf[4];
+                _mm_store_ps(buf, s4);
+                s = buf[0] + buf[1] + buf[2] + buf[3];
+            }
+#endif
+            for( ; i < b1; i++ )
+                s += MIN(err[i], t);
+            truncated += s;
+        }
+
+        if( lossTab )
+        {
+            float l = 0;
+            for( i = b0; i < b1; i++ )
+                l += err[i] <= t ? lossTab[MIN((int)(err[i]*lossScale), lossLast)] : 1.f;
+            magsac += l;
+        }
+
+        if( bail && b1 < count )
+        {
+            // the costs only grow with more points, so the cost so far
+            // (or, for counts, the inliers so far plus all the points
+            // left) bounds the final one
+            double bound = scoring == SCORE_MSAC ? truncated :
+                           scoring == SCORE_MAGSAC ? magsac : -(double)(goodCount + count - b1);
+            // the points are in random order, so b1 points of a model as
+            // good as the best one hold about b1*eps inliers
+            bool unlikely = bailOut == BAILOUT_PROBABILISTIC && bestCount > 0 &&
+                goodCount < b1*eps - bailOutZ*sqrt(b1*eps*(1 - eps));
+            if( bound > bestCost || unlikely )
+            {
+                *cost = DBL_MAX;
+                return -1;
+            }
+        }
+    }
+
+    if( cost )
+    {
+        if( scoring == SCORE_MSAC )
+            *cost = truncated;
+        else if( scoring == SCORE_MLESAC )
+            *cost = icvMLESACCost( err, count, t, goodCount );
+        else if( scoring == SCORE_MAGSAC )
+            *cost = magsac;
+        else
+            *cost = -goodCount;
+    }
+    return goodCount;
+}
+
+static void icvExpandInlierBits( const uint64* bits, CvMat* _mask )
+{
+    int i, count = _mask->rows*_mask->cols;
+    uchar* mask = _mask->data.ptr;
+    for( i = 0; i < count; i++ )
+        mask[i] = (uchar)((bits[i >> 6] >> (i & 63)) & 1);
+}
+
+
+// C(n, k), or limit+1 if it is larger than limit
+static int icvCountSubsets( int n, int k, int limit )
+{
+    int64 c = 1;
+    for( int i = 1; i <= k; i++ )
+    {
+        c = c*(n - k + i)/i;
+        if( c > limit )
+            return limit + 1;
+    }
+    return (int)c;
+}
+
+static void icvCopySubset( const CvMat* m1, const CvMat* m2, CvMat* ms1, CvMat* ms2,
+                           const int* idx, int n )
+{
+    int elemSize = CV_ELEM_SIZE(m1->type);
+    for( int i = 0; i < n; i++ )
+    {
+        memcpy( ms1->data.ptr + i*elemSize, m1->data.ptr + idx[i]*elemSize, elemSize );
+        memcpy( ms2->data.ptr + i*elemSize, m2->data.ptr + idx[i]*elemSize, elemSize );
+    }
+}
+
+CV_IMPL int
+cvRANSACUpdateNumIters( double p, double ep,
+                        int model_points, int max_iters )
+{
+    if( model_points <= 0 )
+        CV_Error( CV_StsOutOfRange, "the number of model points should be positive" );
+
+    p = MAX(p, 0.);
+    p = MIN(p, 1.);
+    ep = MAX(ep, 0.);
+    ep = MIN(ep, 1.);
+
+    // avoid inf's & nan's
+    double num = MAX(1. - p, DBL_MIN);
+    double denom = 1. - pow(1. - ep,model_points);
+    if( denom < DBL_MIN )
+        return 0;
+
+    num = log(num);
+    denom = log(denom);
+
+    return denom >= 0 || -num >= max_iters*(-denom) ?
+        max_iters : cvRound(num/denom);
+}
+
+bool CvModelEstimator2::runRANSAC( const CvMat* m1, const CvMat* m2, CvMat* model,
+                                    CvMat* mask0, double reprojThreshold,
+                                    double confidence, int maxIters )
+{
+    bool result = false;
+    CvMat _models, _err, *models = &_models, *err = &_err;
+    cv::Ptr<CvMat> ms1, ms2;
+
+    int iter, niters = maxIters;
+    int count = m1->rows*m1->cols, maxGoodCount = 0;
+    double minCost = DBL_MAX;
+    CV_Assert( CV_ARE_SIZES_EQ(m1, m2) && CV_ARE_SIZES_EQ(m1, mask0) );
+
+    if( count < modelPoints )
+        return false;
+
+    // with very few subsets, trying them all gives the best consensus
+    // deterministically. The cap is fixed and small: against maxIters,
+    // 1-point models would score every point against every point where
+    // the adaptive loop stops after a handful of samples.
+    const int maxExhaustive = 200;
+    int limit = MIN(maxIters, maxExhaustive);
+    if( count > modelPoints && icvCountSubsets( count, modelPoints, limit ) <= limit )
+        return runExhaustive( m1, m2, model, mask0, reprojThreshold );
+
+    // the probabilistic bail-out extrapolates from the first points of
+    // each hypothesis, so the points are shuffled once for the whole call
+    std::vector<int> perm;
+    cv::Ptr<CvMat> pm1, pm2;
+    if( bailOut == BAILOUT_PROBABILISTIC && count > modelPoints )
+    {
+        perm.resize( count );
+        for( int i = 0; i < count; i++ )
+            perm[i] = i;
+        for( int i = count - 1; i > 0; i-- )
+            std::swap( perm[i], perm[rng.uniform( i + 1 )] );
+        pm1 = cvCreateMat( m1->rows, m1->cols, m1->type );
+        pm2 = cvCreateMat( m2->rows, m2->cols, m2->type );
+        icvCopySubset( m1, m2, pm1, pm2, &perm[0], count );
+        m1 = pm1;
+        m2 = pm2;
+    }
+
+    prepareScoring( m1, m2 );
+
+    // the buffers live in the estimator, so an estimator that is kept
+    // between calls (e.g. one per video stream) does not reallocate them
+    workModels.create( modelSize.height*maxBasicSolutions, modelSize.width, CV_64FC1 );
+    workErr.create( 1, count, CV_32FC1 );
+    _models = workModels;
+    _err = workErr;
+
+    // the masks stay packed in the loop, mask0 is only written at the end
+    std::vector<uint64> mask((count + 63)/64), tmask((count + 63)/64);
+
+    if( count > modelPoints )
+    {
+        ms1 = cvCreateMat( 1, modelPoints, m1->type );
+        ms2 = cvCreateMat( 1, modelPoints, m2->type );
+    }
+    else
+    {
+        niters = 1;
+        ms1 = cvCloneMat(m1);
+        ms2 = cvCloneMat(m2);
+    }
+
+    CvSampleCache samples( sampleCacheSize, modelPoints );
+    buildBuckets( m2 );
+
+    // stratified pre-scoring: a hypothesis is scored on one point per
+    // cell first, and only goes on to the full set if its inlier ratio
+    // there is at least half the best ratio so far
+    std::vector<int> strata;
+    cv::Ptr<CvMat> sm1, sm2, serr;
+    std::vector<uint64> sbits;
+    if( bucketScoring && !pointBucket.empty() )
+    {
+        getStrata( strata );
+        sm1 = cvCreateMat( 1, (int)strata.size(), m1->type );
+        sm2 = cvCreateMat( 1, (int)strata.size(), m2->type );
+        serr = cvCreateMat( 1, (int)strata.size(), CV_32FC1 );
+        sbits.resize( (strata.size() + 63)/64 );
+        icvCopySubset( m1, m2, sm1, sm2, &strata[0], (int)strata.size() );
+    }
+
+    // models given by the caller (e.g. the previous frame's solution) are
+    // scored first; a good one sets the consensus and the iteration bound
+    // before any sample is drawn
+    if( !initialModels.empty() )
+    {
+        CvMat _initial = initialModels;
+        for( int k = 0; k < initialModels.rows/modelSize.height; k++ )
+        {
+            CvMat model_k;
+            cvGetRows( &_initial, &model_k, k*modelSize.height, (k+1)*modelSize.height );
+            double cost;
+            int goodCount = findInlierBits( m1, m2, &model_k, err, &tmask[0], reprojThreshold, &cost,
+                                            minCost, maxGoodCount );
+
+            if( goodCount > modelPoints-1 && cost < minCost )
+            {
+                tmask.swap(mask);
+                cvCopy( &model_k, model );
+                maxGoodCount = goodCount;
+                minCost = cost;
+                niters = cvRANSACUpdateNumIters( confidence,
+                    (double)(count - goodCount)/count, modelPoints, niters );
+            }
+        }
+    }
+
+    for( iter = 0; iter < niters; iter++ )
+    {
+        int i, goodCount, nmodels;
+        if( count > modelPoints )
+        {
+            bool found = getSubset( m1, m2, ms1, ms2, 300 );
+            if( !found )
+            {
+                if( iter == 0 )
+                    return false;
+                break;
+            }
+            if( !samples.insert( &sampleIdx[0] ) )
+            {
+                CV_XADD(&duplicateSamples, 1);
+                continue;
+            }
+        }
+
+        nmodels = runKernel( ms1, ms2, models );
+        if( nmodels <= 0 )
+            continue;
+        for( i = 0; i < nmodels; i++ )
+        {
+            CvMat model_i;
+            cvGetRows( models, &model_i, i*modelSize.height, (i+1)*modelSize.height );
+            if( !strata.empty() && maxGoodCount > 0 )
+            {
+                int sgood = findInlierBits( sm1, sm2, &model_i, serr, &sbits[0], reprojThreshold );
+                if( 2.*sgood*count < (double)maxGoodCount*strata.size() )
+                    continue;
+            }
+
+            double cost;
+            goodCount = findInlierBits( m1, m2, &model_i, err, &tmask[0], reprojThreshold, &cost,
+                                        minCost, maxGoodCount );
+
+            if( goodCount > modelPoints-1 && cost < minCost )
+            {
+                tmask.swap(mask);
+                cvCopy( &model_i, model );
+                maxGoodCount = goodCount;
+                minCost = cost;
+                niters = cvRANSACUpdateNumIters( confidence,
+                    (double)(count - goodCount)/count, modelPoints, niters );
+            }
+        }
+    }
+
+    if( maxGoodCount > 0 )
+    {
+        if( scoring == SCORE_MAGSAC )
+            polishMAGSAC( m1, m2, model, err, &mask[0], reprojThreshold, minCost, maxGoodCount );
+        if( perm.empty() )
+            icvExpandInlierBits( &mask[0], mask0 );
+        else
+            for( int i = 0; i < count; i++ )
+                mask0->data.ptr[perm[i]] = (uchar)((mask[i >> 6] >> (i & 63)) & 1);
+        result = true;
+    }
+
+    return result;
+}
+
+
+// sigma-consensus++: refits the model with the MAGSAC++ weights of its
+// residuals while the loss goes down. bits, cost and goodCount describe
+// model on input and are updated with it.
+void CvModelEstimator2::polishMAGSAC( const CvMat* m1, const CvMat* m2, CvMat* model,
+                                      CvMat* err, uint64* bits, double threshold,
+                                      double& cost, int& goodCount )
+{
+    const int maxIters = 10;
+    int i, count = err->rows*err->cols, last = (int)magsacWeight.size() - 1;
+    float t = (float)(threshold*threshold), scale = (float)magsacWeight.size()/t;
+    cv::Ptr<CvMat> weights = cvCreateMat( 1, count, CV_32FC1 );
+    cv::Ptr<CvMat> polished = cvCreateMat( modelSize.height, modelSize.width, CV_64FC1 );
+    std::vector<uint64> pbits((count + 63)/64);
+
+    for( int iter = 0; iter < maxIters; iter++ )
+    {
+        computeReprojError( m1, m2, model, err );
+        for( i = 0; i < count; i++ )
+        {
+            float e = err->data.fl[i];
+            weights->data.fl[i] = e < t ? magsacWeight[MIN((int)(e*scale), last)] : 0.f;
+        }
+
+        if( !fitWeighted( m1, m2, weights, polished ) )
+            break;
+
+        double pcost;
+        int pgood = findInlierBits( m1, m2, polished, err, &pbits[0], threshold, &pcost );
+        if( pgood < modelPoints || pcost >= cost )
+            break;
+
+        cvCopy( polished, model );
+        std::copy( pbits.begin(), pbits.end(), bits );
+        cost = pcost;
+        goodCount = pgood;
+    }
+}
+
+
+// Scores a range of RANSAC hypotheses, each worker with its own error
+// buffer and mask. The lowest cost wins, ties go to the lowest index.
+class CvRANSACBody : public cv::ParallelLoopBody
+{
+public:
+    CvRANSACBody( CvModelEstimator2* _estimator, const CvMat* _m1, const CvMat* _m2,
+                  const CvMat* _models, double _threshold,
+                  double* _minCost, int* _best, cv::Mutex* _mutex )
+        : estimator(_estimator), m1(_m1), m2(_m2), models(_models), threshold(_threshold),
+          minCost(_minCost), best(_best), mutex(_mutex) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        int height = estimator->modelSize.height, count = m1->rows*m1->cols;
+        cv::Ptr<CvMat> err = cvCreateMat( 1, count, CV_32FC1 );
+        std::vector<uint64> bits((count + 63)/64);
+
+        for( int i = range.start; i < range.end; i++ )
+        {
+            CvMat model_i;
+            cvGetRows( models, &model_i, i*height, (i+1)*height );
+            double cost, bestCost;
+            {
+                cv::AutoLock lock(*mutex);
+                bestCost = *minCost;
+            }
+
+            // only the exact bail-out here, it never cuts off a tie, so
+            // the result does not depend on the scheduling
+            estimator->findInlierBits( m1, m2, &model_i, err, &bits[0], threshold, &cost, bestCost );
+
+            cv::AutoLock lock(*mutex);
+            if( cost < *minCost || (cost == *minCost && i < *best) )
+            {
+                *minCost = cost;
+                *best = i;
+            }
+        }
+    }
+
+private:
+    CvModelEstimator2* estimator;
+    const CvMat *m1, *m2, *models;
+    double threshold;
+    double* minCost;
+    int* best;
+    cv::Mutex* mutex;
+};
+
+
+// RANSAC over every modelPoints-subset of the points, plus the models
+// set by setInitialModels. The kernels run on this thread (they are not
+// required to be reentrant), the scoring runs in parallel. Bucketing has
+// nothing to do here, and only the exact bail-out is used, since it does
+// not depend on the order of the points.
+bool CvModelEstimator2::runExhaustive( const CvMat* m1, const CvMat* m2, CvMat* model,
+                                       CvMat* mask0, double reprojThreshold )
+{
+    int i, count = m1->rows*m1->cols;
+    cv::Ptr<CvMat> models = cvCreateMat( modelSize.height*maxBasicSolutions, modelSize.width, CV_64FC1 );
+    cv::Ptr<CvMat> ms1 = cvCreateMat( 1, modelPoints, m1->type );
+    cv::Ptr<CvMat> ms2 = cvCreateMat( 1, modelPoints, m2->type );
+    cv::Ptr<CvMat> err = cvCreateMat( 1, count, CV_32FC1 );
+    cv::AutoBuffer<int> _idx(modelPoints);
+    int* idx = _idx;
+    cv::Mat hypotheses;
+
+    for( i = 0; i < modelPoints; i++ )
+        idx[i] = i;
+
+    for(;;)
+    {
+        // same degeneracy checks as getSubset
+        bool valid = true;
+        icvCopySubset( m1, m2, ms1, ms2, idx, modelPoints );
+        for( i = checkPartialSubsets ? 1 : modelPoints; i <= modelPoints && valid; i++ )
+            valid = checkSubset( ms1, i ) && checkSubset( ms2, i );
+
+        if( valid )
+        {
+            int nmodels = runKernel( ms1, ms2, models );
+            if( nmodels > 0 )
+                hypotheses.push_back( cv::Mat(models).rowRange(0, nmodels*modelSize.height) );
+        }
+
+        // next subset in lexicographic order
+        for( i = modelPoints - 1; i >= 0 && idx[i] == count - modelPoints + i; i-- )
+            ;
+        if( i < 0 )
+            break;
+        idx[i]++;
+        for( i++; i < modelPoints; i++ )
+            idx[i] = idx[i-1] + 1;
+    }
+
+    // models given by the caller compete with the enumerated ones
+    if( !initialModels.empty() )
+        hypotheses.push_back( initialModels );
+
+    if( hypotheses.empty() )
+        return false;
+
+    int best = 0, goodCount, nhypotheses = hypotheses.rows/modelSize.height;
+    double minCost;
+    CvMat _hypotheses = hypotheses, model_i;
+    std::vector<uint64> bits((count + 63)/64);
+    cv::Mutex mutex;
+
+    prepareScoring( m1, m2 );
+    cvGetRows( &_hypotheses, &model_i, 0, modelSize.height );
+    findInlierBits( m1, m2, &model_i, err, &bits[0], reprojThreshold, &minCost );
+
+    cv::parallel_for_( cv::Range(1, nhypotheses),
+        CvRANSACBody( this, m1, m2, &_hypotheses, reprojThreshold, &minCost, &best, &mutex ) );
+
+    cvGetRows( &_hypotheses, &model_i, best*modelSize.height, (best+1)*modelSize.height );
+    goodCount = findInlierBits( m1, m2, &model_i, err, &bits[0], reprojThreshold );
+    if( goodCount < modelPoints )
+        return false;
+
+    cvCopy( &model_i, model );
+    if( scoring == SCORE_MAGSAC )
+        polishMAGSAC( m1, m2, model, err, &bits[0], reprojThreshold, minCost, goodCount );
+    icvExpandInlierBits( &bits[0], mask0 );
+    return true;
+}
+
+
+// Median of the errors of model. Returns DBL_MAX as soon as enough of 
+// the errors exceed bestMedian that the median cannot beat it. 
+double CvModelEstimator2::computeMedian( const CvMat* m1, const CvMat* m2,
+                                         const CvMat* model, CvMat* _err, double bestMedian )
+{
+    int i, count = _err->rows*_err->cols, half = count/2;
+    float* err = _err->data.fl;
+
+    computeReprojError( m1, m2, model, _err );
+
+    // the median is above bestMedian once count-half errors are (odd
+    // count), or count-half+1 of them (even count)
+    if( bestMedian < DBL_MAX )
+    {
+        int need = count - half + (count % 2 == 0), above = 0;
+        for( i = 0; i < count; i++ )
+            if( err[i] > bestMedian && ++above >= need )
+                return DBL_MAX;
+    }
+
+    std::nth_element( err, err + half, err + count );
+    if( count % 2 != 0 )
+        return err[half];
+    return (*std::max_element( err, err + half ) + err[half])*0.5;
+}
+
+
+// Scores a range of LMedS hypotheses, each worker with its own error
+// buffer. The smallest median wins, ties go to the lowest index so the
+// result does not depend on the scheduling.
+class CvLMeDSBody : public cv::ParallelLoopBody
+{
+public:
+    CvLMeDSBody( CvModelEstimator2* _estimator, const CvMat* _m1, const CvMat* _m2,
+                 const CvMat* _models, double* _minMedian, int* _best, cv::Mutex* _mutex )
+        : estimator(_estimator), m1(_m1), m2(_m2), models(_models),
+          minMedian(_minMedian), best(_best), mutex(_mutex) {}
+
+    void operator()( const cv::Range& range ) const
+    {
+        int height = estimator->modelSize.height;
+        cv::Ptr<CvMat> err = cvCreateMat( 1, m1->rows*m1->cols, CV_32FC1 );
+
+        for( int i = range.start; i < range.end; i++ )
+        {
+            CvMat model_i;
+            double bestMedian;
+            cvGetRows( models, &model_i, i*height, (i+1)*height );
+            {
+                cv::AutoLock lock(*mutex);
+                bestMedian = *minMedian;
+            }
+
+            double median = estimator->computeMedian( m1, m2, &model_i, err, bestMedian );
+
+            cv::AutoLock lock(*mutex);
+            if( median < *minMedian || (median == *minMedian && median < DBL_MAX && i < *best) )
+            {
+                *minMedian = median;
+                *best = i;
+            }
+        }
+    }
+
+private:
+    CvModelEstimator2* estimator;
+    const CvMat *m1, *m2, *models;
+    double* minMedian;
+    int* best;
+    cv::Mutex* mutex;
+};
+
+
+bool CvModelEstimator2::runLMeDS( const CvMat* m1, const CvMat* m2, CvMat* model,
+                                  CvMat* mask, double confidence, int maxIters )
+{
+    const double outlierRatio = 0.45;
+    bool result = false;
+    cv::Ptr<CvMat> models;
+    cv::Ptr<CvMat> ms1, ms2;
+    cv::Ptr<CvMat> err;
+    cv::Mat hypotheses;
+
+    int iter, niters = maxIters;
+    int count = m1->rows*m1->cols;
+    double minMedian = DBL_MAX, sigma;
+
+    CV_Assert( CV_ARE_SIZES_EQ(m1, m2) && CV_ARE_SIZES_EQ(m1, mask) );
+
+    if( count < modelPoints )
+        return false;
+
+    models = cvCreateMat( modelSize.height*maxBasicSolutions, modelSize.width, CV_64FC1 );
+    err = cvCreateMat( 1, count, CV_32FC1 );
+
+    if( count > modelPoints )
+    {
+        ms1 = cvCreateMat( 1, modelPoints, m1->type );
+        ms2 = cvCreateMat( 1, modelPoints, m2->type );
+    }
+    else
+    {
+        niters = 1;
+        ms1 = cvCloneMat(m1);
+        ms2 = cvCloneMat(m2);
+    }
+
+    niters = cvRound(log(1-confidence)/log(1-pow(1-outlierRatio,(double)modelPoints)));
+    niters = MIN( MAX(niters, 3), maxIters );
+
+    // the number of samples does not depend on the scores, so all the
+    // hypotheses are generated first (sampling and the kernels stay
+    // sequential) and scored in parallel afterwards
+    CvSampleCache samples( sampleCacheSize, modelPoints );
+    buildBuckets( m2 );
+
+    for( iter = 0; iter < niters; iter++ )
+    {
+        int nmodels;
+        if( count > modelPoints )
+        {
+            bool found = getSubset( m1, m2, ms1, ms2, 300 );
+            if( !found )
+            {
+                if( iter == 0 )
+                    return false;
+                break;
+            }
+            if( !samples.insert( &sampleIdx[0] ) )
+            {
+                CV_XADD(&duplicateSamples, 1);
+                continue;
+            }
+        }
+
+        nmodels = runKernel( ms1, ms2, models );
+        if( nmodels <= 0 )
+            continue;
+        hypotheses.push_back( cv::Mat(models).rowRange(0, nmodels*modelSize.height) );
+    }
+
+    if( !hypotheses.empty() )
+    {
+        int best = 0, nhypotheses = hypotheses.rows/modelSize.height;
+        CvMat _hypotheses = hypotheses, model_i;
+        cv::Mutex mutex;
+
+        prepareScoring( m1, m2 );
+        cvGetRows( &_hypotheses, &model_i, 0, modelSize.height );
+        minMedian = computeMedian( m1, m2, &model_i, err, DBL_MAX );
+
+        cv::parallel_for_( cv::Range(1, nhypotheses),
+            CvLMeDSBody( this, m1, m2, &_hypotheses, &minMedian, &best, &mutex ) );
+
+        cvGetRows( &_hypotheses, &model_i, best*modelSize.height, (best+1)*modelSize.height );
+        cvCopy( &model_i, model );
+    }
+
+    if( minMedian < DBL_MAX )
+    {
+        sigma = 2.5*1.4826*(1 + 5./(count - modelPoints))*sqrt(minMedian);
+        sigma = MAX( sigma, 0.001 );
+
+        count = findInliers( m1, m2, model, err, mask, sigma );
+        result = count >= modelPoints;
+    }
+
+    return result;
+}
+
+
+// Puts each point in a cell of a bucketGrid x bucketGrid grid over the
+// bounding box of m2, using the first two values of each element, in
+// O(n). pointBucket stays empty if bucketing is off, or if fewer than
+// modelPoints cells are occupied.
+void CvModelEstimator2::buildBuckets( const CvMat* m2 )
+{
+    int i, count = m2->rows*m2->cols, cn = CV_MAT_CN(m2->type), noccupied = 0;
+    const double* p = m2->data.db;
+    double x0 = DBL_MAX, y0 = DBL_MAX, x1 = -DBL_MAX, y1 = -DBL_MAX;
+
+    pointBucket.clear();
+    if( bucketGrid <= 1 || CV_MAT_DEPTH(m2->type) != CV_64F || cn < 2 || count <= modelPoints )
+        return;
+
+    for( i = 0; i < count; i++ )
+    {
+        x0 = MIN(x0, p[i*cn]); x1 = MAX(x1, p[i*cn]);
+        y0 = MIN(y0, p[i*cn+1]); y1 = MAX(y1, p[i*cn+1]);
+    }
+    double sx = bucketGrid/MAX(x1 - x0, DBL_EPSILON);
+    double sy = bucketGrid/MAX(y1 - y0, DBL_EPSILON);
+
+    std::vector<int> population(bucketGrid*bucketGrid, 0);
+    pointBucket.resize(count);
+    for( i = 0; i < count; i++ )
+    {
+        int bx = MIN(cvFloor((p[i*cn] - x0)*sx), bucketGrid - 1);
+        int by = MIN(cvFloor((p[i*cn+1] - y0)*sy), bucketGrid - 1);
+        int b = MAX(by, 0)*bucketGrid + MAX(bx, 0);
+        pointBucket[i] = b;
+        if( population[b]++ == 0 )
+            noccupied++;
+    }
+
+    if( noccupied < modelPoints )
+        pointBucket.clear();
+}
+
+// One random point per occupied bucket (reservoir sampling), for the
+// stratified pre-scoring
+void CvModelEstimator2::getStrata( std::vector<int>& strata )
+{
+    int i, count = (int)pointBucket.size();
+    std::vector<int> seen(bucketGrid*bucketGrid, 0), pick(bucketGrid*bucketGrid, -1);
+
+    for( i = 0; i < count; i++ )
+    {
+        int b = pointBucket[i];
+        if( rng.uniform( ++seen[b] ) == 0 )
+            pick[b] = i;
+    }
+
+    strata.clear();
+    for( i = 0; i < (int)pick.size(); i++ )
+        if( pick[i] >= 0 )
+            strata.push_back(pick[i]);
+}
+
+
+// Next modelPoints distinct indices in [0, count). The samples are drawn
+// with Floyd's algorithm, a block at a time, without retries.
+void CvModelEstimator2::nextSample( int count, int* idx )
+{
+    const int blockSize = 64;
+    if( sampleBlockCount != count || sampleBlockPos >= (int)sampleBlock.size() )
+    {
+        sampleBlock.resize( blockSize*modelPoints );
+        for( int s = 0; s < blockSize; s++ )
+        {
+            int* sample = &sampleBlock[s*modelPoints];
+            for( int n = 0, j = count - modelPoints; j < count; j++, n++ )
+            {
+                int m, t = (int)rng.uniform( j + 1 );
+                for( m = 0; m < n && sample[m] != t; m++ )
+                    ;
+                sample[n] = m < n ? j : t;
+            }
+        }
+        sampleBlockPos = 0;
+        sampleBlockCount = count;
+    }
+    std::copy( &sampleBlock[sampleBlockPos], &sampleBlock[sampleBlockPos] + modelPoints, idx );
+    sampleBlockPos += modelPoints;
+}
+
+
+bool CvModelEstimator2::getSubset( const CvMat* m1, const CvMat* m2,
+                                   CvMat* ms1, CvMat* ms2, int maxAttempts )
+{
+    sampleIdx.resize(modelPoints);
+    int* idx = &sampleIdx[0];
+    int i, j, iters, count = m1->cols*m1->rows;
+
+    assert( CV_IS_MAT_CONT(m1->type & m2->type) );
+
+    // whole samples come from the Floyd sampler, and a degenerate one is
+    // replaced by the next. With bucketing, each point is drawn uniformly
+    // and redrawn while its cell is already in the sample, so the cells
+    // are weighted by population. Setting up the buckets checked that at
+    // least modelPoints cells are occupied.
+    for( iters = 0; iters < maxAttempts; iters++ )
+    {
+        if( pointBucket.empty() )
+            nextSample( count, idx );
+        else
+        {
+            for( i = 0; i < modelPoints; i++ )
+            {
+                do
+                {
+                    idx[i] = (int)rng.uniform( count );
+                    for( j = 0; j < i && pointBucket[idx[j]] != pointBucket[idx[i]]; j++ )
+                        ;
+                }
+                while( j < i );
+            }
+        }
+
+        icvCopySubset( m1, m2, ms1, ms2, idx, modelPoints );
+        for( i = checkPartialSubsets ? 1 : modelPoints; i <= modelPoints; i++ )
+            if( !checkSubset( ms1, i ) || !checkSubset( ms2, i ) )
+                break;
+        if( i > modelPoints )
+            return true;
+    }
+    return false;
+}
+
+
+bool CvModelEstimator2::checkSubset( const CvMat* m, int count )
+{
+    int j, k, i, i0, i1;
+    CvPoint2D64f* ptr = (CvPoint2D64f*)m->data.ptr;
+
+    assert( CV_MAT_TYPE(m->type) == CV_64FC2 );
+
+    if( checkPartialSubsets )
+        i0 = i1 = count - 1;
+    else
+        i0 = 0, i1 = count - 1;
+
+    for( i = i0; i <= i1; i++ )
+    {
+        // check that the i-th selected point does not belong
+        // to a line connecting some previously selected points
+        for( j = 0; j < i; j++ )
+        {
+            double dx1 = ptr[j].x - ptr[i].x;
+            double dy1 = ptr[j].y - ptr[i].y;
+            for( k = 0; k < j; k++ )
+            {
+                double dx2 = ptr[k].x - ptr[i].x;
+                double dy2 = ptr[k].y - ptr[i].y;
+                if( fabs(dx2*dy1 - dy2*dx1) <= FLT_EPSILON*(fabs(dx1) + fabs(dy1) + fabs(dx2) + fabs(dy2)))
+                    break;
+            }
+            if( k < j )
+                break;
+        }
+        if( j < i )
+            break;
+    }
+
+    return i >= i1;
+}
+
+
+namespace cv
+{
+
+class Affine3DEstimator : public CvModelEstimator2
+{
+public:
+    Affine3DEstimator() : CvModelEstimator2(4, cvSize(4, 3), 1) {}
+    virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model );
+protected:
+    virtual void computeReprojError( const CvMat* m1, const CvMat* m2, const CvMat* model, CvMat* error );
+    virtual bool checkSubset( const CvMat* ms1, int count );
+};
+
+}
+
+int cv::Affine3DEstimator::runKernel( const CvMat* m1, const CvMat* m2, CvMat* model )
+{
+    const Point3d* from = reinterpret_cast<const Point3d*>(m1->data.ptr);
+    const Point3d* to   = reinterpret_cast<const Point3d*>(m2->data.ptr);
+
+    Mat A(12, 12, CV_64F);
+    Mat B(12, 1, CV_64F);
+    A = Scalar(0.0);
+
+    for(int i = 0; i < modelPoints; ++i)
+    {
+        *B.ptr<Point3d>(3*i) = to[i];
+
+        double *aptr = A.ptr<double>(3*i);
+        for(int k = 0; k < 3; ++k)
+        {
+            aptr[3] = 1.0;
+            *reinterpret_cast<Point3d*>(aptr) = from[i];
+            aptr += 16;
+        }
+    }
+
+    CvMat cvA = A;
+    CvMat cvB = B;
+    CvMat cvX;
+    cvReshape(model, &cvX, 1, 12);
+    cvSolve(&cvA, &cvB, &cvX, CV_SVD );
+
+    return 1;
+}
+
+void cv::Affine3DEstimator::computeReprojError( const CvMat* m1, const CvMat* m2, const CvMat* model, CvMat* error )
+{
+    int count = m1->rows * m1->cols;
+    const Point3d* from = reinterpret_cast<const Point3d*>(m1->data.ptr);
+    const Point3d* to   = reinterpret_cast<const Point3d*>(m2->data.ptr);
+    const double* F = model->data.db;
+    float* err = error->data.fl;
+
+    for(int i = 0; i < count; i++ )
+    {
+        const Point3d& f = from[i];
+        const Point3d& t = to[i];
+
+        double a = F[0]*f.x + F[1]*f.y + F[ 2]*f.z + F[ 3] - t.x;
+        double b = F[4]*f.x + F[5]*f.y + F[ 6]*f.z + F[ 7] - t.y;
+        double c = F[8]*f.x + F[9]*f.y + F[10]*f.z + F[11] - t.z;
+
+        err[i] = (float)sqrt(a*a + b*b + c*c);
+    }
+}
+
+bool cv::Affine3DEstimator::checkSubset( const CvMat* ms1, int count )
+{
+    CV_Assert( CV_MAT_TYPE(ms1->type) == CV_64FC3 );
+
+    int j, k, i = count - 1;
+    const Point3d* ptr = reinterpret_cast<const Point3d*>(ms1->data.ptr);
+
+    // check that the i-th selected point does not belong
+    // to a line connecting some previously selected points
+
+    for(j = 0; j < i; ++j)
+    {
+        Point3d d1 = ptr[j] - ptr[i];
+        double n1 = norm(d1);
+
+        for(k = 0; k < j; ++k)
+        {
+            Point3d d2 = ptr[k] - ptr[i];
+            double n = norm(d2) * n1;
+
+            if (fabs(d1.dot(d2) / n) > 0.996)
+                break;
+        }
+        if( k < j )
+            break;
+    }
+
+    return j == i;
+}
+
+int cv::estimateAffine3D(InputArray _from, InputArray _to,
+                         OutputArray _out, OutputArray _inliers,
+                         double param1, double param2)
+{
+    Mat from = _from.getMat(), to = _to.getMat();
+    int count = from.checkVector(3, CV_32F);
+
+    CV_Assert( count >= 0 && to.checkVector(3, CV_32F) == count );
+
+    _out.create(3, 4, CV_64F);
+    Mat out = _out.getMat();
+
+    _inliers.create(count, 1, CV_8U, -1, true);
+    Mat inliers = _inliers.getMat();
+    inliers = Scalar::all(1);
+
+    Mat dFrom, dTo;
+    from.convertTo(dFrom, CV_64F);
+    to.convertTo(dTo, CV_64F);
+
+    CvMat F3x4 = out;
+    CvMat mask  = inliers;
+    CvMat m1 = dFrom;
+    CvMat m2 = dTo;
+
+    const double epsilon = numeric_limits<double>::epsilon();
+    param1 = param1 <= 0 ? 3 : param1;
+    param2 = (param2 < epsilon) ? 0.99 : (param2 > 1 - epsilon) ? 0.99 : param2;
+
+    return Affine3DEstimator().runRANSAC(&m1, &m2, &F3x4, &mask, param1, param2 );
+}
@@ -0,0 +1,322 @@
+/*  Copyright (c) 2013, Bo Li, prclibo@gmail.com
+    All rights reserved.
+    
+    Redistribution and use in source and binary forms, with or without
+    modification, are permitted provided that the following conditions are met:
+        * Redistributions of source code must retain the above copyright
+          notice, this list of conditions and the following disclaimer.
+        * Redistributions in binary form must reproduce the above copyright
+          notice, this list of conditions and the following disclaimer in the
+          documentation and/or other materials provided with the distribution.
+        * Neither the name of the copyright holder nor the
+          names of its contributors may be used to endorse or promote products
+          derived from this software without specific prior written permission.
+    
+    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+    ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+    WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+    DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+    DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+    (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+    LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+    ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+    (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+    SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <opencv2/opencv.hpp>
+#include "two-point-translation.hpp"
+#include "_modelest.h"
+
+/*
+ * Translation direction from a known relative rotation. With the first 
+ * bearings pre-rotated, y1 = R * x1, the epipolar constraint 
+ * x2' [t]x y1 = 0 becomes t . (y1 x x2) = 0, which is linear in t. 
+ * Two correspondences give t as the cross product of their constraint 
+ * normals, and the inliers are refitted in the least-squares sense. 
+ */
+
+using namespace cv; 
+
+static Matx33d two_point_translation_rotation(InputArray _rotation)
+{
+    Mat r; 
+    _rotation.getMat().convertTo(r, CV_64F); 
+    Matx33d R; 
+    if (r.total() == 3)
+        Rodrigues(r.reshape(1, 3), R); 
+    else
+    {
+        CV_Assert( r.rows == 3 && r.cols == 3 && r.channels() == 1 ); 
+        R = Matx33d(r.ptr<double>()); 
+    }
+    return R; 
+}
+
+class CvTwoPointTranslationEstimator : public CvModelEstimator2
+{
+    Matx33d R; 
+public:
+    CvTwoPointTranslationEstimator( const Matx33d & _R ); 
+    virtual int runKernel( const CvMat* m1, const CvMat* m2, CvMat* model ); 
+    virtual bool refine( const CvMat* m1, const CvMat* m2, CvMat* model, int maxIters ); 
+protected: 
+    virtual void computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error );
+    virtual bool getSubset( const CvMat* m1, const CvMat* m2,
+                            CvMat* ms1, CvMat* ms2, int maxAttempts ); 
+    virtual bool checkSubset( const CvMat* ms1, int count ); 
+}; 
+
+// The two constraint normals y1 x x2 of a sample must not be parallel, 
+// or t, their cross product, is undefined. 
+static bool two_point_translation_degenerate(const Vec3d * y1, const Vec3d * x2)
+{
+    Vec3d n0 = y1[0].cross(x2[0]), n1 = y1[1].cross(x2[1]); 
+    double l0 = norm(n0), l1 = norm(n1); 
+    return l0 < DBL_EPSILON || l1 < DBL_EPSILON || 
+           norm(n0.cross(n1)) <= FLT_EPSILON * l0 * l1; 
+}
+
+CvTwoPointTranslationEstimator::CvTwoPointTranslationEstimator( const Matx33d & _R )
+: CvModelEstimator2( 2, cvSize(3, 1), 1 ), R( _R )
+{
+}
+
+// m1 holds the pre-rotated bearings R * (x1, y1, 1) and m2 the bearings 
+// (x2, y2, 1), both 1 row x n col x 3 channels. 
+int CvTwoPointTranslationEstimator::runKernel( const CvMat* m1, const CvMat* m2, CvMat* model )
+{
+    const Vec3d * y1 = (const Vec3d *)m1->data.db; 
+    const Vec3d * x2 = (const Vec3d *)m2->data.db; 
+
+    if (two_point_translation_degenerate(y1, x2)) 
+        return 0; 
+    Vec3d t = y1[0].cross(x2[0]).cross(y1[1].cross(x2[1])); 
+    double n = norm(t); 
+
+    t *= 1.0 / n; 
+    memcpy(model->data.db, t.val, sizeof(t.val)); 
+    return 1; 
+}
+
+// Sampson error with E = [t]x R, error is CV_32FC1. 
+void CvTwoPointTranslationEstimator::computeReprojError( const CvMat* m1, const CvMat* m2,
+                                     const CvMat* model, CvMat* error )
+{
+    Vec3d t(model->data.db); 
+    int count = m1->rows * m1->cols; 
+    const Vec3d * y1 = (const Vec3d *)m1->data.db; 
+    const Vec3d * x2 = (const Vec3d *)m2->data.db; 
+    for (int i = 0; i < count; i++)
+    {
+        // E * x1 = t x y1 and E' * x2 = R' * (x2 x t)
+        Vec3d Ex1 = t.cross(y1[i]); 
+        Vec3d x2t = x2[i].cross(t); 
+        double e0 = R(0, 0) * x2t[0] + R(1, 0) * x2t[1] + R(2, 0) * x2t[2]; 
+        double e1 = R(0, 1) * x2t[0] + R(1, 1) * x2t[1] + R(2, 1) * x2t[2]; 
+        double x2tEx1 = x2[i].dot(Ex1); 
+        double a = Ex1[0] * Ex1[0] + Ex1[1] * Ex1[1]; 
+        double b = e0 * e0 + e1 * e1; 
+        error->data.fl[i] = (float)(x2tEx1 * x2tEx1 / (a + b)); 
+    }
+}
+
+// Draws samples until one has non-parallel constraint normals, e.g. not 
+// a point picked twice or two points on a line through the epipole. 
+bool CvTwoPointTranslationEstimator::getSubset( const CvMat* m1, const CvMat* m2,
+                                                CvMat* ms1, CvMat* ms2, int maxAttempts )
+{
+    for (int i = 0; i < maxAttempts; i++)
+    {
+        if (!CvModelEstimator2::getSubset(m1, m2, ms1, ms2, 1)) 
+            continue; 
+        if (!two_point_translation_degenerate((const Vec3d *)ms1->data.db, (const Vec3d *)ms2->data.db)) 
+            return true; 
+    }
+    return false; 
+}
+
+// The degeneracy depends on both images, so it is tested in getSubset 
+// (and in runKernel for the exhaustive path) instead. The default test 
+// is for 2D points and does not apply to the bearings. 
+bool CvTwoPointTranslationEstimator::checkSubset( const CvMat*, int )
+{
+    return true; 
+}
+
+/*
+ * Least-squares refit on the inliers m1, m2: t minimizes the sum of 
+ * Sampson errors, solved as an eigenvector problem with weights from 
+ * the previous t (maxIters reweighting passes). 
+ */
+bool CvTwoPointTranslationEstimator::refine( const CvMat* m1, const CvMat* m2, CvMat* model, int maxIters )
+{
+    int count = m1->rows * m1->cols; 
+    if (count < 2) 
+        return false; 
+
+    const Vec3d * y1 = (const Vec3d *)m1->data.db; 
+    const Vec3d * x2 = (const Vec3d *)m2->data.db; 
+    Vec3d t(model->data.db); 
+
+    for (int iter = 0; iter < maxIters; iter++)
+    {
+        Matx33d A = Matx33d::zeros(); 
+        for (int i = 0; i < count; i++)
+        {
+            Vec3d n = y1[i].cross(x2[i]); 
+            Vec3d Ex1 = t.cross(y1[i]); 
+            Vec3d x2t = x2[i].cross(t); 
+            double e0 = R(0, 0) * x2t[0] + R(1, 0) * x2t[1] + R(2, 0) * x2t[2]; 
+            double e1 = R(0, 1) * x2t[0] + R(1, 1) * x2t[1] + R(2, 1) * x2t[2]; 
+            double w = Ex1[0] * Ex1[0] + Ex1[1] * Ex1[1] + e0 * e0 + e1 * e1; 
+            if (w < DBL_EPSILON) 
+                continue; 
+            A += n * n.t() * (1.0 / w); 
+        }
+
+        Matx31d evals; 
+        Matx33d evecs; 
+        eigen(A, evals, evecs); 
+        Vec3d t_new(evecs(2, 0), evecs(2, 1), evecs(2, 2)); 
+        if (t_new.dot(t) < 0) 
+            t_new = -t_new; 
+
+        double change = norm(t_new - t); 
+        t = t_new; 
+        if (change < 1e-12) 
+            break; 
+    }
+
+    memcpy(model->data.db, t.val, sizeof(t.val)); 
+    return true; 
+}
+
+// Cheirality vote as in the 4-point modules, returns true if -t puts 
+// more of the points in front of both cameras. 
+static bool two_point_translation_flip(const Mat & rotated1, const Mat & points2, const Mat & mask, const Vec3d & t)
+{
+    const Vec3d * y1s = rotated1.ptr<Vec3d>(); 
+    const Vec3d * x2s = points2.ptr<Vec3d>(); 
+    const uchar * m = mask.ptr<uchar>(); 
+    int n = (int)rotated1.total(); 
+
+    int positive = 0, negative = 0; 
+    for (int i = 0; i < n; i++)
+    {
+        if (!m[i]) continue; 
+        const Vec3d & y1 = y1s[i], & x2 = x2s[i]; 
+
+        // From d2 * x2 = d1 * R * x1 + t 
+        double d1 = -x2.cross(t).dot(x2.cross(y1)); 
+        double d2 = y1.cross(t).dot(y1.cross(x2)); 
+        if (d1 > 0 && d2 > 0) positive++; 
+        else if (d1 < 0 && d2 < 0) negative++; 
+    }
+    return negative > positive; 
+}
+
+void findTranslation2pt(cv::InputArray _points1, cv::InputArray _points2, 
+              cv::InputArray rotation, double focal, cv::Point2d pp, 
+              cv::OutputArray _tvecs, 
+              int method, double prob, double threshold, cv::OutputArray _mask)
+{
+	Mat points1, points2; 
+	_points1.getMat().copyTo(points1); 
+	_points2.getMat().copyTo(points2); 
+
+	int npoints = points1.checkVector(2);
+    CV_Assert( npoints >= 2 && points2.checkVector(2) == npoints &&
+				              points1.type() == points2.type());
+
+	if (points1.channels() > 1)
+	{
+		points1 = points1.reshape(1, npoints); 
+		points2 = points2.reshape(1, npoints); 
+	}
+	points1.convertTo(points1, CV_64F); 
+	points2.convertTo(points2, CV_64F); 
+
+	points1.col(0) = (points1.col(0) - pp.x) / focal; 
+	points2.col(0) = (points2.col(0) - pp.x) / focal; 
+	points1.col(1) = (points1.col(1) - pp.y) / focal; 
+	points2.col(1) = (points2.col(1) - pp.y) / focal; 
+
+    // Pre-rotate the first bearings once, RANSAC then only sees the 
+    // translation. Both sets are 1 row x n col x 3 channels. 
+    Matx33d R = two_point_translation_rotation(rotation); 
+    Mat rotated1(1, npoints, CV_64FC3), bearings2(1, npoints, CV_64FC3); 
+    for (int i = 0; i < npoints; i++)
+    {
+        Vec3d x1(points1.at<double>(i, 0), points1.at<double>(i, 1), 1.0); 
+        rotated1.at<Vec3d>(i) = R * x1; 
+        bearings2.at<Vec3d>(i) = Vec3d(points2.at<double>(i, 0), points2.at<double>(i, 1), 1.0); 
+    }
+
+	Mat tvec(1, 3, CV_64F); 
+    CvTwoPointTranslationEstimator estimator(R); 
+
+	CvMat p1 = rotated1; 
+	CvMat p2 = bearings2; 
+	CvMat _tvec = tvec; 
+	CvMat* tempMask = cvCreateMat(1, npoints, CV_8U); 
+	
+	threshold /= focal; 
+    bool found; 
+    if (npoints == 2)
+    {
+        found = estimator.runKernel(&p1, &p2, &_tvec) > 0; 
+        cvSet(tempMask, cvScalarAll(1)); 
+    }
+    else if (method == CV_RANSAC)
+	{
+		found = estimator.runRANSAC(&p1, &p2, &_tvec, tempMask, threshold, prob); 
+	}
+	else
+	{
+		found = estimator.runLMeDS(&p1, &p2, &_tvec, tempMask, prob); 
+	}
+
+    // Non-minimal refit on the inliers
+    Mat mask(tempMask); 
+    if (found && npoints > 2)
+    {
+        int ninliers = countNonZero(mask); 
+        Mat in1(1, ninliers, CV_64FC3), in2(1, ninliers, CV_64FC3); 
+        for (int i = 0, j = 0; i < npoints; i++)
+        {
+            if (!mask.at<uchar>(i)) continue; 
+            in1.at<Vec3d>(j) = rotated1.at<Vec3d>(i); 
+            in2.at<Vec3d>(j) = bearings2.at<Vec3d>(i); 
+            j++; 
+        }
+        CvMat q1 = in1, q2 = in2; 
+        estimator.refine(&q1, &q2, &_tvec, 10); 
+    }
+
+    if (_mask.needed())
+    {
+    	_mask.create(1, npoints, CV_8U, -1, true); 
+    	Mat m = _mask.getMat(); 
+    	mask.copyTo(m); 
+    }
+
+    if (!found)
+    {
+        cvReleaseMat(&tempMask); 
+        _tvecs.release(); 
+        return; 
+    }
+
+    // The cheirality-consistent sign of tvec comes first
+    Vec3d t(tvec.ptr<double>()); 
+    if (two_point_translation_flip(rotated1, bearings2, mask, t)) 
+        t = -t; 
+    cvReleaseMat(&tempMask); 
+
+    _tvecs.create(3, 2, CV_64F, -1, true); 
+    Mat tvecs = _tvecs.getMat(); 
+    tvecs.col(0) = Mat(t) * 1.0; 
+    tvecs.col(1) = -Mat(t) * 1.0; 
+}